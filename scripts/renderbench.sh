@@ -0,0 +1,9 @@
+#!/bin/sh
+# Run the rendering benchmark on a machine without a GPU.
+# Needs xvfb-run and Mesa (llvmpipe). Run from the directory holding assets/.
+#   scripts/renderbench.sh ./deerportal-renderbench --frames 300 --output renderbench.json
+# "drawCalls" is the mean number of GL draw calls per frame (see DP::DrawStats).
+BENCH=${1:-./deerportal-renderbench}
+[ $# -gt 0 ] && shift
+LIBGL_ALWAYS_SOFTWARE=1 GALLIUM_DRIVER=llvmpipe \
+  xvfb-run -a -s "-screen 0 1360x768x24" "$BENCH" "$@"
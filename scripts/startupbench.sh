@@ -0,0 +1,19 @@
+#!/bin/sh
+# Time startup up to the first menu frame and fail when it exceeds a budget.
+# Needs xvfb-run and Mesa (llvmpipe). Run from the directory holding assets/.
+#   scripts/startupbench.sh ./DeerPortal 5000 startup.json
+# The first run fills the texture cache; later runs show the warm start.
+GAME=${1:-./DeerPortal}
+BUDGET_MS=${2:-5000}
+OUTPUT=${3:-startup.json}
+LIBGL_ALWAYS_SOFTWARE=1 GALLIUM_DRIVER=llvmpipe \
+  xvfb-run -a -s "-screen 0 1360x768x24" "$GAME" --startup-bench "$OUTPUT" || exit 1
+cat "$OUTPUT"
+TOTAL=$(sed -n 's/.*"total_ms": \([0-9.e+-]*\).*/\1/p' "$OUTPUT")
+if awk -v total="$TOTAL" -v budget="$BUDGET_MS" 'BEGIN { exit !(total != "" && total <= budget) }'
+then
+  echo "startup: ${TOTAL} ms, budget ${BUDGET_MS} ms"
+else
+  echo "startup: ${TOTAL} ms exceeds the budget of ${BUDGET_MS} ms" >&2
+  exit 1
+fi
@@ -1,200 +1,216 @@
 #include "animated-board-item.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-void AnimatedBoardItem::initialize(int id, sf::Vector2f spawn, sf::Vector2f target, int texId) {
-  diamondId = id;
-  textureId = texId;
-  spawnPoint = spawn;
-  progress = 0.0f;
-  rotationAngle = 0.0f;
-  currentScale = 0.3f;
-  finished = false;
+namespace {
+// Branch-free sine/cosine for degrees in [-180, 180) (max error ~0.001),
+// written with selects only so the evaluate loop stays vectorizable.
+inline float fastSin(float radians) {
+  const float b = 4.0f / static_cast<float>(M_PI);
+  const float c = -4.0f / static_cast<float>(M_PI * M_PI);
+  float y = b * radians + c * radians * std::fabs(radians);
+  return 0.225f * (y * std::fabs(y) - y) + y;
+}
 
-  // GEMINI FIX: The provided `target` is the TOP-LEFT position.
-  // The animation logic (Bezier, rotation) uses the CENTER point.
-  // We must convert the target to be the center for internal calculations.
-  const float finalSize = 35.2f; // Must match final size in BoardDiamondSeq rendering
-  const float finalHalfSize = finalSize / 2.0f;
-  targetPoint = target + sf::Vector2f(finalHalfSize, finalHalfSize);
+inline void fastSinCos(float degrees, float& sine, float& cosine) {
+  const float pi = static_cast<float>(M_PI);
+  const float x = degrees * (pi / 180.0f);
+  float xc = x + pi * 0.5f;
+  xc = xc >= pi ? xc - 2.0f * pi : xc;
+  sine = fastSin(x);
+  cosine = fastSin(xc);
+}
+} // namespace
 
-  initializeBezierPath(spawn, targetPoint);
+void AnimatedBoardItemBatch::clear() {
+  for (auto* array : {&p0x, &p0y, &p1x, &p1y, &p2x, &p2y, &p3x, &p3y, &startTime, &texLeft,
+                      &progress, &posX, &posY, &scale, &rotation, &cosRotation, &sinRotation}) {
+    array->clear();
+  }
+  lastStartTime = 0.0f;
+}
 
-#ifndef NDEBUG
-  // Only debug first 3 diamonds to avoid excessive output
-  if (diamondId < 3) {
-    std::cout << "[DEBUG] Diamond " << diamondId << " initialized: spawn(" << spawn.x << ", "
-              << spawn.y << ") target(" << target.x << ", " << target.y << ")" << std::endl;
+void AnimatedBoardItemBatch::reserve(size_t count) {
+  for (auto* array : {&p0x, &p0y, &p1x, &p1y, &p2x, &p2y, &p3x, &p3y, &startTime, &texLeft,
+                      &progress, &posX, &posY, &scale, &rotation, &cosRotation, &sinRotation}) {
+    array->reserve(count);
   }
-#endif
 }
 
-void AnimatedBoardItem::initializeBezierPath(sf::Vector2f spawn, sf::Vector2f target) {
-  // Create curved path using cubic Bezier curve
-  bezierPoints[0] = spawn;  // Start point
-  bezierPoints[3] = target; // End point
+void AnimatedBoardItemBatch::add(sf::Vector2f spawn, sf::Vector2f target, int textureId,
+                                 float start) {
+  // GEMINI FIX: The provided `target` is the TOP-LEFT position.
+  // The animation logic (Bezier, rotation) uses the CENTER point.
+  const float finalHalfSize = DIAMOND_SIZE / 2.0f;
+  const sf::Vector2f targetPoint = target + sf::Vector2f(finalHalfSize, finalHalfSize);
 
   // For center-origin animation, create radial explosion paths
-  sf::Vector2f direction = target - spawn;
+  sf::Vector2f direction = targetPoint - spawn;
   float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-  
-  // Normalize direction
   if (distance > 0) {
     direction /= distance;
   }
 
-  // Create slight curve for visual interest in radial explosion
+  // Control points create gentle S-curve from center outward (10% of distance)
   sf::Vector2f perpendicular(-direction.y, direction.x);
-  
-  // Subtle curve amount for natural radial movement (10% of distance)
   float curveAmount = distance * 0.1f;
-  
-  // Control points create gentle S-curve from center outward
-  bezierPoints[1] = spawn + direction * (distance * 0.3f) + perpendicular * curveAmount;
-  bezierPoints[2] = spawn + direction * (distance * 0.7f) - perpendicular * curveAmount;
+  sf::Vector2f control1 = spawn + direction * (distance * 0.3f) + perpendicular * curveAmount;
+  sf::Vector2f control2 = spawn + direction * (distance * 0.7f) - perpendicular * curveAmount;
+
+  p0x.push_back(spawn.x);
+  p0y.push_back(spawn.y);
+  p1x.push_back(control1.x);
+  p1y.push_back(control1.y);
+  p2x.push_back(control2.x);
+  p2y.push_back(control2.y);
+  p3x.push_back(targetPoint.x);
+  p3y.push_back(targetPoint.y);
+  startTime.push_back(start);
+  texLeft.push_back(textureId * 44.0f);
+
+  progress.push_back(0.0f);
+  posX.push_back(spawn.x);
+  posY.push_back(spawn.y);
+  scale.push_back(1.0f);
+  rotation.push_back(0.0f);
+  cosRotation.push_back(1.0f);
+  sinRotation.push_back(0.0f);
+
+  lastStartTime = std::max(lastStartTime, start);
 
 #ifndef NDEBUG
   // Only debug first 3 diamonds to avoid excessive output
-  if (diamondId < 3) {
-    std::cout << "[DEBUG] Diamond " << diamondId << " Bezier path: "
-              << "P0(" << bezierPoints[0].x << ", " << bezierPoints[0].y << ") "
-              << "P1(" << bezierPoints[1].x << ", " << bezierPoints[1].y << ") "
-              << "P2(" << bezierPoints[2].x << ", " << bezierPoints[2].y << ") "
-              << "P3(" << bezierPoints[3].x << ", " << bezierPoints[3].y << ")" << std::endl;
+  if (size() <= 3) {
+    std::cout << "[DEBUG] Diamond " << size() - 1 << " Bezier path: "
+              << "P0(" << spawn.x << ", " << spawn.y << ") "
+              << "P1(" << control1.x << ", " << control1.y << ") "
+              << "P2(" << control2.x << ", " << control2.y << ") "
+              << "P3(" << targetPoint.x << ", " << targetPoint.y << ")" << std::endl;
   }
 #endif
 }
 
-sf::Vector2f AnimatedBoardItem::calculateBezierPosition(float t) const {
-  // Cubic Bezier curve calculation: B(t) = (1-t)³P₀ + 3(1-t)²tP₁ + 3(1-t)t²P₂ + t³P₃
-  float invT = 1.0f - t;
-  float invT2 = invT * invT;
-  float invT3 = invT2 * invT;
-  float t2 = t * t;
-  float t3 = t2 * t;
-
-  return invT3 * bezierPoints[0] + 3.0f * invT2 * t * bezierPoints[1] +
-         3.0f * invT * t2 * bezierPoints[2] + t3 * bezierPoints[3];
-}
-
-float AnimatedBoardItem::easeOutCubic(float t) const {
-  return 1.0f - std::pow(1.0f - t, 3.0f);
+void AnimatedBoardItemBatch::evaluate(float elapsed, const BoardAnimationConfig& config) {
+  const size_t count = size();
+  const float invDuration =
+      config.animationDuration > 0.0f ? 1.0f / config.animationDuration : 1.0e6f;
+  const float startScale = config.startScale;
+  const float scaleRange = config.endScale - config.startScale;
+  const float spin = config.enableRotation ? config.rotationSpeed : 0.0f;
+
+  const float* const start = startTime.data();
+  const float *const ax = p0x.data(), *const ay = p0y.data();
+  const float *const bx = p1x.data(), *const by = p1y.data();
+  const float *const cx = p2x.data(), *const cy = p2y.data();
+  const float *const dx = p3x.data(), *const dy = p3y.data();
+  float* const outProgress = progress.data();
+  float *const outX = posX.data(), *const outY = posY.data();
+  float* const outScale = scale.data();
+  float* const outRotation = rotation.data();
+  float *const outCos = cosRotation.data(), *const outSin = sinRotation.data();
+
+  for (size_t i = 0; i < count; ++i) {
+    float local = elapsed - start[i];
+    local = local > 0.0f ? local : 0.0f;
+    float t = local * invDuration;
+    t = t < 1.0f ? t : 1.0f;
+    outProgress[i] = t;
+
+    // Ease-out cubic for smooth deceleration
+    const float u = 1.0f - t;
+    const float e = 1.0f - u * u * u;
+
+    // Cubic Bezier: B(e) = (1-e)^3 P0 + 3(1-e)^2 e P1 + 3(1-e) e^2 P2 + e^3 P3
+    const float v = 1.0f - e;
+    const float w0 = v * v * v;
+    const float w1 = 3.0f * v * v * e;
+    const float w2 = 3.0f * v * e * e;
+    const float w3 = e * e * e;
+    outX[i] = w0 * ax[i] + w1 * bx[i] + w2 * cx[i] + w3 * dx[i];
+    outY[i] = w0 * ay[i] + w1 * by[i] + w2 * cy[i] + w3 * dy[i];
+
+    outScale[i] = startScale + scaleRange * e;
+
+    // Spin while flying, exactly 0 on landing to match the static diamonds
+    float angle = t < 1.0f ? spin * local : 0.0f;
+    angle -= static_cast<float>(static_cast<int>(angle * (1.0f / 360.0f))) * 360.0f;
+    angle = angle >= 180.0f ? angle - 360.0f : angle;
+    angle = angle < -180.0f ? angle + 360.0f : angle;
+    outRotation[i] = angle;
+    fastSinCos(angle, outSin[i], outCos[i]);
+  }
 }
 
-void AnimatedBoardItem::update(sf::Time deltaTime, const BoardAnimationConfig& config) {
-  if (finished) return;
-
-  float progressIncrement = deltaTime.asSeconds() / config.animationDuration;
-  progress += progressIncrement;
-
-  if (progress >= 1.0f) {
-    progress = 1.0f;
-    finished = true;
-  }
+void AnimatedBoardItemBatch::writeVertices(sf::Vertex* vertices, float elapsed) const {
+  const size_t count = size();
+  const float halfDiamond = DIAMOND_SIZE * 0.5f;
 
-  // Apply easing for smooth deceleration
-  float easedProgress = easeOutCubic(progress);
-
-  // Update scale with easing
-  currentScale = config.startScale + (config.endScale - config.startScale) * easedProgress;
-
-  // Update rotation if enabled - smoothly transition to 0.0 degrees at end
-  if (config.enableRotation) {
-    if (progress < 1.0f) {
-      // During animation: rotate normally
-      rotationAngle += config.rotationSpeed * deltaTime.asSeconds();
-      if (rotationAngle > 360.0f) {
-        rotationAngle -= 360.0f;
-      }
-    } else {
-      // Animation finished: ensure rotation is exactly 0.0 to match static diamonds
-      rotationAngle = 0.0f;
+  for (size_t i = 0; i < count; ++i) {
+    const float local = elapsed - startTime[i];
+    if (local < 0.0f) {
+      // Not started yet: keep holding at the spawn point, as drawn before the animation
+      writeSpawnQuad(vertices + i * 6, i);
+      continue;
     }
+
+    // Fade in during the first 0.2 seconds only for items that just started
+    const float alpha = local < FADE_IN_TIME ? local / FADE_IN_TIME : 1.0f;
+    const sf::Color color(255, 255, 255, static_cast<std::uint8_t>(alpha * 255.0f));
+
+    // Corners of the rotated quad around the item center
+    const float h = halfDiamond * scale[i];
+    const float c = h * cosRotation[i];
+    const float s = h * sinRotation[i];
+    const float x = posX[i];
+    const float y = posY[i];
+
+    const float left = texLeft[i];
+    const float right = left + 44.0f;
+
+    sf::Vertex* quad = vertices + i * 6;
+    const sf::Vertex topLeft{{x - c + s, y - s - c}, color, {left, 0.0f}};
+    const sf::Vertex topRight{{x + c + s, y + s - c}, color, {right, 0.0f}};
+    const sf::Vertex bottomRight{{x + c - s, y + s + c}, color, {right, 44.0f}};
+    const sf::Vertex bottomLeft{{x - c - s, y - s + c}, color, {left, 44.0f}};
+
+    // Two triangles: 0, 1, 2 and 0, 2, 3
+    quad[0] = topLeft;
+    quad[1] = topRight;
+    quad[2] = bottomRight;
+    quad[3] = topLeft;
+    quad[4] = bottomRight;
+    quad[5] = bottomLeft;
   }
 }
 
-sf::Vector2f AnimatedBoardItem::getCurrentPosition() const {
-  float easedProgress = easeOutCubic(progress);
-  return calculateBezierPosition(easedProgress);
+void AnimatedBoardItemBatch::writeSpawnVertices(sf::Vertex* vertices) const {
+  // All diamonds fully visible, unrotated and full size at their spawn points
+  const size_t count = size();
+  for (size_t i = 0; i < count; ++i)
+    writeSpawnQuad(vertices + i * 6, i);
 }
 
-void AnimatedBoardItem::addToVertexArray(sf::VertexArray& vertices, int vertexOffset,
-                                         const sf::Texture& texture) const {
-  if (finished && progress >= 1.0f) {
-    return; // Don't render if animation is complete
-  }
-
-  sf::Vector2f position = getCurrentPosition();
-  sf::Vector2u textureSize = texture.getSize();
-
-  // Diamond sprite size (must match BoardDiamondSeq: 35.2f = 44.0f * 0.8f)
-  float size = 35.2f * currentScale;
-  float halfSize = size * 0.5f;
-
-  // Calculate rotated vertices
-  float cosAngle = std::cos(rotationAngle * M_PI / 180.0f);
-  float sinAngle = std::sin(rotationAngle * M_PI / 180.0f);
-
-  // Define quad corners
-  sf::Vector2f corners[4] = {
-      sf::Vector2f(-halfSize, -halfSize), // Top-left
-      sf::Vector2f(halfSize, -halfSize),  // Top-right
-      sf::Vector2f(halfSize, halfSize),   // Bottom-right
-      sf::Vector2f(-halfSize, halfSize)   // Bottom-left
-  };
-
-  // Apply rotation to corners
-  sf::Vector2f rotatedCorners[4];
-  for (int i = 0; i < 4; i++) {
-    rotatedCorners[i] = sf::Vector2f(corners[i].x * cosAngle - corners[i].y * sinAngle,
-                                     corners[i].x * sinAngle + corners[i].y * cosAngle) +
-                        position;
-  }
-
-  // Define texture coordinates based on textureId (same as BoardDiamond)
-  float texLeft = textureId * 44.0f;
-  float texRight = texLeft + 44.0f;
-  float texTop = 0.0f;
-  float texBottom = 44.0f;
-
-  sf::Vector2f texCoords[4] = {
-      sf::Vector2f(texLeft, texTop),     // Top-left
-      sf::Vector2f(texRight, texTop),    // Top-right
-      sf::Vector2f(texRight, texBottom), // Bottom-right
-      sf::Vector2f(texLeft, texBottom)   // Bottom-left
-  };
-
-  // Create two triangles to form a quad (6 vertices total)
-  // Note: vertexOffset should be calculated for 6 vertices per item, not 4
-
-  // First triangle: 0, 1, 2
-  vertices[vertexOffset + 0].position = rotatedCorners[0];
-  vertices[vertexOffset + 0].texCoords = texCoords[0];
-  vertices[vertexOffset + 0].color = sf::Color::White;
-
-  vertices[vertexOffset + 1].position = rotatedCorners[1];
-  vertices[vertexOffset + 1].texCoords = texCoords[1];
-  vertices[vertexOffset + 1].color = sf::Color::White;
-
-  vertices[vertexOffset + 2].position = rotatedCorners[2];
-  vertices[vertexOffset + 2].texCoords = texCoords[2];
-  vertices[vertexOffset + 2].color = sf::Color::White;
-
-  // Second triangle: 0, 2, 3
-  vertices[vertexOffset + 3].position = rotatedCorners[0];
-  vertices[vertexOffset + 3].texCoords = texCoords[0];
-  vertices[vertexOffset + 3].color = sf::Color::White;
-
-  vertices[vertexOffset + 4].position = rotatedCorners[2];
-  vertices[vertexOffset + 4].texCoords = texCoords[2];
-  vertices[vertexOffset + 4].color = sf::Color::White;
-
-  vertices[vertexOffset + 5].position = rotatedCorners[3];
-  vertices[vertexOffset + 5].texCoords = texCoords[3];
-  vertices[vertexOffset + 5].color = sf::Color::White;
-}
\ No newline at end of file
+void AnimatedBoardItemBatch::writeSpawnQuad(sf::Vertex* quad, size_t i) const {
+  const float h = DIAMOND_SIZE * 0.5f;
+  const sf::Color color = sf::Color::White;
+  const float x = p0x[i];
+  const float y = p0y[i];
+  const float left = texLeft[i];
+  const float right = left + 44.0f;
+
+  const sf::Vertex topLeft{{x - h, y - h}, color, {left, 0.0f}};
+  const sf::Vertex bottomRight{{x + h, y + h}, color, {right, 44.0f}};
+  quad[0] = topLeft;
+  quad[1] = sf::Vertex{{x + h, y - h}, color, {right, 0.0f}};
+  quad[2] = bottomRight;
+  quad[3] = topLeft;
+  quad[4] = bottomRight;
+  quad[5] = sf::Vertex{{x - h, y + h}, color, {left, 44.0f}};
+}
@@ -29,6 +29,8 @@
 
 #include <cmath>
 
+#include "draw-stats.h"
+
 AnimatedSprite::AnimatedSprite(sf::Time frameTime, bool paused, bool looped)
     : m_animation(NULL), m_frameTime(frameTime), m_currentFrame(0), m_isPaused(paused),
       m_isLooped(looped), m_texture(NULL) {
@@ -170,5 +172,6 @@ void AnimatedSprite::draw(sf::RenderTarget& target, sf::RenderStates states) con
     states.transform *= getTransform();
     states.texture = m_texture;
     target.draw(m_vertices, 4, sf::PrimitiveType::TriangleFan, states);
+    DP::DrawStats::count();
   }
 }
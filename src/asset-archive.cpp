@@ -0,0 +1,149 @@
+#include "asset-archive.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+
+#include "filetools.h"
+#include "little-endian.h"
+#include "texture-cache.h"
+
+namespace DP {
+
+namespace {
+std::string relativeName(const std::string& file) {
+  const std::string prefix(ASSETS_PATH);
+  if (file.compare(0, prefix.size(), prefix) == 0) {
+    return file.substr(prefix.size());
+  }
+  return file;
+}
+} // namespace
+
+AssetArchive& AssetArchive::getInstance() {
+  static AssetArchive instance;
+  return instance;
+}
+
+AssetArchive::AssetArchive() {
+  const std::string path = get_full_path(FILE_NAME);
+  if (!file.open(path) || file.size() < HEADER_SIZE) {
+#ifndef NDEBUG
+    std::cout << "AssetArchive: no " << path << ", loading loose files" << std::endl;
+#endif
+    file.close();
+    return;
+  }
+  if (!parse()) {
+    std::cerr << "AssetArchive: " << path << " is damaged, loading loose files" << std::endl;
+    entries.clear();
+    file.close();
+    return;
+  }
+#ifndef NDEBUG
+  std::cout << "AssetArchive: mapped " << entries.size() << " assets from " << path << " ("
+            << file.size() / 1024 << " KiB)" << std::endl;
+#endif
+}
+
+bool AssetArchive::parse() {
+  const unsigned char* mapping = file.data();
+  const std::size_t mappingSize = file.size();
+  if (std::memcmp(mapping, MAGIC, sizeof(MAGIC)) != 0 || readU32(mapping + 4) != VERSION) {
+    return false;
+  }
+  const std::uint32_t count = readU32(mapping + 8);
+
+  std::size_t cursor = HEADER_SIZE;
+  entries.reserve(count);
+  for (std::uint32_t i = 0; i < count; ++i) {
+    if (mappingSize - cursor < 20) {
+      return false;
+    }
+    const std::uint64_t offset = readU64(mapping + cursor);
+    const std::uint64_t size = readU64(mapping + cursor + 8);
+    const std::uint32_t nameLength = readU32(mapping + cursor + 16);
+    cursor += 20;
+    if (mappingSize - cursor < nameLength || offset > mappingSize ||
+        size > mappingSize - offset) {
+      return false;
+    }
+    std::string name(reinterpret_cast<const char*>(mapping + cursor), nameLength);
+    cursor += nameLength;
+    entries[std::move(name)] = Entry{mapping + offset, static_cast<std::size_t>(size)};
+  }
+  return true;
+}
+
+const AssetArchive::Entry* AssetArchive::find(const std::string& file) const {
+  if (entries.empty()) {
+    return nullptr;
+  }
+  auto it = entries.find(relativeName(file));
+  return it == entries.end() ? nullptr : &it->second;
+}
+
+bool loadAsset(sf::Texture& texture, const std::string& file) {
+  DecodedPixels pixels;
+  return TextureCache::getInstance().decode(file, pixels) && pixels.upload(texture);
+}
+
+bool loadAsset(sf::Image& image, const std::string& file) {
+  DecodedPixels pixels;
+  if (!TextureCache::getInstance().decode(file, pixels)) {
+    return false;
+  }
+  pixels.copyTo(image);
+  return true;
+}
+
+bool loadAsset(sf::SoundBuffer& buffer, const std::string& file) {
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    return buffer.loadFromMemory(entry->data, entry->size);
+  }
+  return buffer.loadFromFile(getAssetPath(file));
+}
+
+bool openAsset(sf::Font& font, const std::string& file) {
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    return font.openFromMemory(entry->data, entry->size);
+  }
+  return font.openFromFile(getAssetPath(file));
+}
+
+bool openAsset(sf::Music& music, const std::string& file) {
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    return music.openFromMemory(entry->data, entry->size);
+  }
+  return music.openFromFile(getAssetPath(file));
+}
+
+bool openAsset(sf::InputSoundFile& soundFile, const std::string& file) {
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    return soundFile.openFromMemory(entry->data, entry->size);
+  }
+  return soundFile.openFromFile(getAssetPath(file));
+}
+
+std::string readAssetText(const std::string& file) {
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    return std::string(static_cast<const char*>(entry->data), entry->size);
+  }
+  std::ifstream stream(getAssetPath(file), std::ios::binary);
+  if (!stream) {
+    return std::string();
+  }
+  std::ostringstream contents;
+  contents << stream.rdbuf();
+  return contents.str();
+}
+
+std::string getAssetPath(const std::string& file) {
+  return get_full_path(std::string(ASSETS_PATH) + relativeName(file));
+}
+
+} // namespace DP
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "mapped-file.h"
+
+namespace sf {
+class Texture;
+class Image;
+class Font;
+class SoundBuffer;
+class InputSoundFile;
+class Music;
+} // namespace sf
+
+namespace DP {
+
+/*!
+ * \brief AssetArchive serves assets from a packed, memory-mapped assets.pak
+ *
+ * The archive is written at build time by deerportal-pack and mapped once, on
+ * first use, for the lifetime of the process. Lookups are a hash map probe and
+ * loaders decode straight from the mapping, so a cold start touches one file
+ * instead of resolving and opening every asset separately. Fonts and music
+ * stream from the mapping, which is why it is never unmapped while running.
+ *
+ * Without an archive every lookup misses and the load helpers below fall back
+ * to the loose files under ASSETS_PATH.
+ *
+ * Layout, all integers little-endian:
+ *   "DPAK", u32 version, u32 entry count, u32 reserved
+ *   per entry: u64 offset, u64 size, u32 name length, name bytes
+ *   entry data, each blob aligned to ALIGNMENT bytes
+ */
+class AssetArchive {
+public:
+  static constexpr char MAGIC[4] = {'D', 'P', 'A', 'K'};
+  static constexpr std::uint32_t VERSION = 1;
+  static constexpr std::size_t HEADER_SIZE = 16;
+  static constexpr std::size_t ALIGNMENT = 16;
+  static constexpr const char* FILE_NAME = "assets.pak";
+
+  struct Entry {
+    const void* data;
+    std::size_t size;
+  };
+
+  // Maps FILE_NAME, located like any other asset, on the first call
+  static AssetArchive& getInstance();
+
+  AssetArchive(const AssetArchive&) = delete;
+  AssetArchive& operator=(const AssetArchive&) = delete;
+
+  bool isOpen() const { return file.isOpen(); }
+
+  /*!
+   * \brief find looks an asset up by its path inside assets/
+   * \param file e.g. "img/deer-god.png"; a leading ASSETS_PATH is ignored
+   * \return nullptr when there is no archive or it does not contain the file
+   */
+  const Entry* find(const std::string& file) const;
+
+private:
+  AssetArchive();
+  ~AssetArchive() = default;
+
+  bool parse();
+
+  MappedFile file;
+  std::unordered_map<std::string, Entry> entries;
+};
+
+/*
+ * Load helpers: archive first, loose file second. `file` is relative to the
+ * assets directory like AssetArchive::find. Fonts, music and sound files keep
+ * reading from the archive after opening; the mapping outlives them.
+ */
+bool loadAsset(sf::Texture& texture, const std::string& file);
+bool loadAsset(sf::Image& image, const std::string& file);
+bool loadAsset(sf::SoundBuffer& buffer, const std::string& file);
+bool openAsset(sf::Font& font, const std::string& file);
+bool openAsset(sf::Music& music, const std::string& file);
+bool openAsset(sf::InputSoundFile& soundFile, const std::string& file);
+
+// Whole file as text, e.g. shader source; empty if missing
+std::string readAssetText(const std::string& file);
+
+// Where the loose copy of `file` lives on disk
+std::string getAssetPath(const std::string& file);
+
+} // namespace DP
@@ -0,0 +1,224 @@
+#include "asset-loader.h"
+
+#include <algorithm>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+#include "asset-archive.h"
+#include "profiler.h"
+
+namespace DP {
+
+AssetLoader::AssetLoader()
+  : started(false)
+  , uploaded(0)
+  , nextJob(0) {}
+
+AssetLoader::~AssetLoader() {
+  // Workers check the index before every job, so this stops them early
+  nextJob.store(jobs.size());
+  joinWorkers();
+}
+
+void AssetLoader::addTexture(sf::Texture& texture, const std::string& file,
+                             const std::string& failureMessage, Fallback fallback) {
+  Job job;
+  job.kind = Kind::TEXTURE;
+  job.file = file;
+  job.failureMessage = failureMessage;
+  job.fallback = std::move(fallback);
+  job.target = &texture;
+  jobs.push_back(std::move(job));
+}
+
+void AssetLoader::addImage(sf::Image& image, const std::string& file, Fallback fallback) {
+  Job job;
+  job.kind = Kind::IMAGE;
+  job.file = file;
+  job.failureMessage = "Failed to load image";
+  job.fallback = std::move(fallback);
+  job.target = &image;
+  jobs.push_back(std::move(job));
+}
+
+void AssetLoader::addSound(sf::SoundBuffer& buffer, const std::string& file,
+                           const std::string& failureMessage, Fallback fallback) {
+  Job job;
+  job.kind = Kind::SOUND;
+  job.file = file;
+  job.failureMessage = failureMessage;
+  job.fallback = std::move(fallback);
+  job.target = &buffer;
+  jobs.push_back(std::move(job));
+}
+
+void AssetLoader::decode(Job& job) {
+  DP_PROFILE_ZONE("AssetLoader::decode");
+  if (job.kind != Kind::SOUND) {
+    job.decoded = TextureCache::getInstance().decode(job.file, job.pixels);
+    return;
+  }
+
+  sf::InputSoundFile file;
+  if (!openAsset(file, job.file)) {
+    return;
+  }
+  job.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+  const std::uint64_t read = file.read(job.samples.data(), job.samples.size());
+  job.samples.resize(static_cast<std::size_t>(read));
+  job.channelCount = file.getChannelCount();
+  job.sampleRate = file.getSampleRate();
+  job.channelMap = file.getChannelMap();
+  job.decoded = !job.samples.empty();
+}
+
+bool AssetLoader::upload(Job& job) {
+  bool loaded = job.decoded;
+  if (loaded) {
+    switch (job.kind) {
+    case Kind::TEXTURE:
+      loaded = job.pixels.upload(*static_cast<sf::Texture*>(job.target));
+      break;
+    case Kind::IMAGE:
+      job.pixels.copyTo(*static_cast<sf::Image*>(job.target));
+      break;
+    case Kind::SOUND:
+      loaded = static_cast<sf::SoundBuffer*>(job.target)
+                   ->loadFromSamples(job.samples.data(), job.samples.size(), job.channelCount,
+                                     job.sampleRate, job.channelMap);
+      break;
+    }
+  }
+
+  // The decoded copy is not needed once it lives in the target
+  job.pixels.clear();
+  std::vector<std::int16_t>().swap(job.samples);
+  return loaded;
+}
+
+DeerPortal::AssetLoadException AssetLoader::makeError(const Job& job) {
+  const DeerPortal::AssetLoadException::AssetType type =
+      job.kind == Kind::SOUND ? DeerPortal::AssetLoadException::SOUND
+                              : DeerPortal::AssetLoadException::TEXTURE;
+  return DeerPortal::AssetLoadException(type, job.file, job.failureMessage);
+}
+
+void AssetLoader::work() {
+  DP_PROFILE_THREAD("Asset decoder");
+  for (std::size_t i = nextJob.fetch_add(1); i < jobs.size(); i = nextJob.fetch_add(1)) {
+    decode(jobs[i]);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished.push_back(i);
+    }
+    jobDone.notify_one();
+  }
+}
+
+void AssetLoader::joinWorkers() {
+  for (std::thread& worker : workers) {
+    if (worker.joinable()) worker.join();
+  }
+  workers.clear();
+}
+
+void AssetLoader::start(unsigned int maxWorkers) {
+  if (started) {
+    return;
+  }
+  started = true;
+  clock.restart();
+  if (jobs.empty()) {
+    return;
+  }
+
+  unsigned int wanted = std::max(1u, std::thread::hardware_concurrency());
+  if (maxWorkers > 0) {
+    wanted = std::min(wanted, maxWorkers);
+  }
+  wanted = static_cast<unsigned int>(std::min<std::size_t>(wanted, jobs.size()));
+  try {
+    for (unsigned int i = 0; i < wanted; ++i) {
+      workers.emplace_back(&AssetLoader::work, this);
+    }
+  } catch (const std::system_error& e) {
+    std::cerr << "AssetLoader: cannot start decoder thread: " << e.what() << std::endl;
+  }
+  if (workers.empty()) {
+    // No threads at all; decode in place, still feeding the same queue
+    work();
+  }
+}
+
+void AssetLoader::uploadJob(std::size_t index) {
+  Job& job = jobs[index];
+  if (!upload(job)) {
+    const DeerPortal::AssetLoadException error = makeError(job);
+    if (job.fallback) {
+      job.fallback(error);
+    } else if (!firstError) {
+      firstError = error;
+    }
+  }
+  ++uploaded;
+}
+
+std::size_t AssetLoader::uploadReady(sf::Time budget) {
+  DP_PROFILE_ZONE("AssetLoader::uploadReady");
+  sf::Clock spent;
+  std::size_t count = 0;
+  while (!isDone() && (count == 0 || spent.getElapsedTime() < budget)) {
+    std::size_t index;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (finished.empty()) break;
+      index = finished.front();
+      finished.pop_front();
+    }
+    uploadJob(index);
+    ++count;
+  }
+  if (isDone()) {
+    joinWorkers();
+  }
+  return count;
+}
+
+void AssetLoader::finish(const Progress& progress) {
+  DP_PROFILE_ZONE("AssetLoader::finish");
+  start();
+  while (!isDone()) {
+    std::size_t index;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      jobDone.wait(lock, [&] { return !finished.empty(); });
+      index = finished.front();
+      finished.pop_front();
+    }
+    uploadJob(index);
+    if (progress) {
+      progress(uploaded, jobs.size(), jobs[index].file);
+    }
+  }
+  joinWorkers();
+
+#ifndef NDEBUG
+  std::cout << "AssetLoader: " << jobs.size() << " assets in "
+            << clock.getElapsedTime().asSeconds() * 1000.0f << " ms" << std::endl;
+#endif
+
+  if (firstError) {
+    const DeerPortal::AssetLoadException error = *firstError;
+    firstError.reset();
+    throw error;
+  }
+}
+
+void AssetLoader::load(const Progress& progress) {
+  DP_PROFILE_ZONE("AssetLoader::load");
+  start();
+  finish(progress);
+}
+
+} // namespace DP
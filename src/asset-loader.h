@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+
+#include "exceptions.h"
+#include "texture-cache.h"
+
+namespace DP {
+
+/*!
+ * \brief AssetLoader decodes a batch of assets in parallel
+ *
+ * File reads and PNG/OGG decoding run on a small worker pool; images come
+ * from the TextureCache when it has them. Only the GPU upload of textures and
+ * the hand-over of decoded samples to sound buffers happen on the calling
+ * thread, which owns the GL context. Uploads are done in completion order, so
+ * the first finished asset does not wait for the slowest one, and each decoded
+ * copy is released right after its upload.
+ *
+ * load() does all of it in one blocking call. For streaming, start() only
+ * launches the workers; the owner then calls uploadReady() once per frame and
+ * finish() when it cannot wait any longer.
+ *
+ * Targets are only touched from the calling thread, inside uploadReady() and
+ * finish(), and must outlive the loader.
+ */
+class AssetLoader {
+public:
+  using Progress =
+      std::function<void(std::size_t loaded, std::size_t total, const std::string& name)>;
+  using Fallback = std::function<void(const DeerPortal::AssetLoadException&)>;
+
+  AssetLoader();
+  ~AssetLoader(); // Skips jobs not yet started and joins the workers
+
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  /*!
+   * \brief addTexture queues a texture
+   * \param file Path relative to the assets directory, e.g. "img/deer-god.png"
+   * \param failureMessage Message of the exception raised when it fails
+   * \param fallback Called instead of throwing when the file cannot be decoded
+   */
+  void addTexture(sf::Texture& texture, const std::string& file, const std::string& failureMessage,
+                  Fallback fallback = {});
+
+  // Decoded only; for pixels used on the CPU such as the window icon
+  void addImage(sf::Image& image, const std::string& file, Fallback fallback = {});
+
+  void addSound(sf::SoundBuffer& buffer, const std::string& file,
+                const std::string& failureMessage, Fallback fallback = {});
+
+  /*!
+   * \brief load decodes and uploads everything queued
+   * \param progress Called on the calling thread after every finished asset
+   * \throws DeerPortal::AssetLoadException for the first failed asset without
+   * a fallback, once all workers are done
+   */
+  void load(const Progress& progress = {});
+
+  /*!
+   * \brief start begins decoding in the background; nothing may be added after
+   * \param maxWorkers Upper bound on decoder threads, 0 for one per core
+   */
+  void start(unsigned int maxWorkers = 0);
+
+  /*!
+   * \brief uploadReady uploads assets that finished decoding, without waiting
+   * \param budget Stop once this much time was spent; at least one asset is
+   * uploaded if any is ready
+   * \return Number of assets uploaded
+   */
+  std::size_t uploadReady(sf::Time budget);
+
+  /*!
+   * \brief finish waits for the remaining assets and uploads them
+   * \throws DeerPortal::AssetLoadException like load()
+   */
+  void finish(const Progress& progress = {});
+
+  bool isStarted() const { return started; }
+  bool isDone() const { return uploaded == jobs.size(); }
+  std::size_t size() const { return jobs.size(); }
+
+private:
+  enum class Kind { TEXTURE, IMAGE, SOUND };
+
+  struct Job {
+    Kind kind;
+    std::string file;
+    std::string failureMessage;
+    Fallback fallback;
+    void* target;
+
+    // Filled by a worker
+    bool decoded = false;
+    DecodedPixels pixels;
+    std::vector<std::int16_t> samples;
+    unsigned int channelCount = 0;
+    unsigned int sampleRate = 0;
+    std::vector<sf::SoundChannel> channelMap;
+  };
+
+  std::vector<Job> jobs;
+  bool started;
+  std::size_t uploaded;
+  std::optional<DeerPortal::AssetLoadException> firstError;
+
+  // Shared with the workers
+  std::atomic<std::size_t> nextJob;
+  std::mutex mutex;
+  std::condition_variable jobDone;
+  std::deque<std::size_t> finished;
+  std::vector<std::thread> workers;
+  sf::Clock clock;
+
+  void work();
+  void joinWorkers();
+  void uploadJob(std::size_t index);
+  static void decode(Job& job);
+  static bool upload(Job& job);
+  static DeerPortal::AssetLoadException makeError(const Job& job);
+};
+
+} // namespace DP
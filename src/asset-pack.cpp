@@ -0,0 +1,106 @@
+// deerportal-pack: build step that writes assets/ into one assets.pak
+//   deerportal-pack <assets directory> <output file>
+// See AssetArchive for the layout.
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "asset-archive.h"
+#include "little-endian.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+struct PackedFile {
+  std::string name; // Relative, '/' separated
+  fs::path path;
+  std::uint64_t size;
+  std::uint64_t offset;
+};
+
+std::uint64_t alignUp(std::uint64_t value) {
+  const std::uint64_t alignment = DP::AssetArchive::ALIGNMENT;
+  return (value + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " <assets directory> <output file>" << std::endl;
+    return 2;
+  }
+  const fs::path root(argv[1]);
+  const fs::path output(argv[2]);
+
+  std::vector<PackedFile> files;
+  std::error_code error;
+  for (fs::recursive_directory_iterator it(root, error), end; !error && it != end;
+       it.increment(error)) {
+    if (!it->is_regular_file()) continue;
+    const std::string name = it->path().lexically_relative(root).generic_string();
+    // Editor and OS droppings have no business in a release archive
+    if (name.empty() || name[0] == '.' || name.find("/.") != std::string::npos) continue;
+    files.push_back(PackedFile{name, it->path(), static_cast<std::uint64_t>(it->file_size()), 0});
+  }
+  if (error) {
+    std::cerr << "deerportal-pack: cannot read " << root.string() << ": " << error.message()
+              << std::endl;
+    return 1;
+  }
+  // Stable order keeps the archive reproducible between builds
+  std::sort(files.begin(), files.end(),
+            [](const PackedFile& a, const PackedFile& b) { return a.name < b.name; });
+
+  std::uint64_t offset = DP::AssetArchive::HEADER_SIZE;
+  for (const PackedFile& file : files) {
+    offset += 20 + file.name.size();
+  }
+  for (PackedFile& file : files) {
+    file.offset = alignUp(offset);
+    offset = file.offset + file.size;
+  }
+
+  std::ofstream out(output, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    std::cerr << "deerportal-pack: cannot write " << output.string() << std::endl;
+    return 1;
+  }
+  out.write(DP::AssetArchive::MAGIC, sizeof(DP::AssetArchive::MAGIC));
+  DP::writeU32(out, DP::AssetArchive::VERSION);
+  DP::writeU32(out, static_cast<std::uint32_t>(files.size()));
+  DP::writeU32(out, 0);
+  for (const PackedFile& file : files) {
+    DP::writeU64(out, file.offset);
+    DP::writeU64(out, file.size);
+    DP::writeU32(out, static_cast<std::uint32_t>(file.name.size()));
+    out.write(file.name.data(), static_cast<std::streamsize>(file.name.size()));
+  }
+
+  std::vector<char> buffer;
+  for (const PackedFile& file : files) {
+    while (static_cast<std::uint64_t>(out.tellp()) < file.offset) {
+      out.put('\0');
+    }
+    std::ifstream in(file.path, std::ios::binary);
+    buffer.resize(static_cast<std::size_t>(file.size));
+    if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+      std::cerr << "deerportal-pack: cannot read " << file.path.string() << std::endl;
+      return 1;
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  }
+
+  if (!out.flush()) {
+    std::cerr << "deerportal-pack: failed writing " << output.string() << std::endl;
+    return 1;
+  }
+  std::cout << "deerportal-pack: " << files.size() << " files, "
+            << static_cast<std::uint64_t>(out.tellp()) / 1024 << " KiB -> " << output.string()
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,142 @@
+#include "asset-streamer.h"
+
+#include <iostream>
+#include <utility>
+
+#include "profiler.h"
+
+namespace DP {
+
+AssetStreamer::Manifest::Manifest(const std::string& manifestName, std::set<int> neededStates,
+                                  std::set<int> prefetchStates)
+  : name(manifestName)
+  , needed(std::move(neededStates))
+  , prefetch(std::move(prefetchStates))
+  , residency(Residency::RELEASED) {}
+
+void AssetStreamer::Manifest::addTexture(sf::Texture& texture, const std::string& file,
+                                         const std::string& failureMessage,
+                                         AssetLoader::Fallback fallback) {
+  textures.push_back({&texture, file, failureMessage, std::move(fallback)});
+}
+
+void AssetStreamer::Manifest::addSound(sf::SoundBuffer& buffer, const std::string& file,
+                                       const std::string& failureMessage,
+                                       AssetLoader::Fallback fallback) {
+  sounds.push_back({&buffer, file, failureMessage, std::move(fallback)});
+}
+
+AssetStreamer::AssetStreamer() : currentState(0), hasState(false) {}
+
+AssetStreamer::Manifest& AssetStreamer::addManifest(const std::string& name,
+                                                    std::set<int> neededStates,
+                                                    std::set<int> prefetchStates) {
+  manifests.push_back(
+      std::make_unique<Manifest>(name, std::move(neededStates), std::move(prefetchStates)));
+  return *manifests.back();
+}
+
+void AssetStreamer::setState(int state, const AssetLoader::Progress& progress) {
+  if (hasState && state == currentState) {
+    return;
+  }
+  DP_PROFILE_ZONE("AssetStreamer::setState");
+  currentState = state;
+  hasState = true;
+
+  // Release first, so memory goes down before anything new is decoded
+  for (const std::unique_ptr<Manifest>& manifest : manifests) {
+    if (manifest->residency != Residency::RELEASED && manifest->needed.count(state) == 0 &&
+        manifest->prefetch.count(state) == 0) {
+      release(*manifest);
+    }
+  }
+
+  for (const std::unique_ptr<Manifest>& manifest : manifests) {
+    if (manifest->residency == Residency::RELEASED && manifest->prefetch.count(state) > 0) {
+      startLoading(*manifest, PREFETCH_WORKERS);
+    }
+  }
+
+  for (const std::unique_ptr<Manifest>& manifest : manifests) {
+    if (manifest->needed.count(state) == 0) {
+      continue;
+    }
+    if (manifest->residency == Residency::RELEASED) {
+      startLoading(*manifest, 0);
+    }
+    if (manifest->residency == Residency::LOADING) {
+      finishLoading(*manifest, progress);
+    }
+  }
+}
+
+void AssetStreamer::update(sf::Time budget) {
+  DP_PROFILE_ZONE("AssetStreamer::update");
+  sf::Clock spent;
+  for (const std::unique_ptr<Manifest>& manifest : manifests) {
+    if (manifest->residency != Residency::LOADING) {
+      continue;
+    }
+    const sf::Time left = budget - spent.getElapsedTime();
+    if (left <= sf::Time::Zero) {
+      break;
+    }
+    manifest->loader->uploadReady(left);
+    if (manifest->loader->isDone()) {
+      finishLoading(*manifest, {});
+    }
+  }
+}
+
+bool AssetStreamer::isResident(const std::string& name) const {
+  for (const std::unique_ptr<Manifest>& manifest : manifests) {
+    if (manifest->name == name) {
+      return manifest->residency == Residency::RESIDENT;
+    }
+  }
+  return false;
+}
+
+void AssetStreamer::startLoading(Manifest& manifest, unsigned int maxWorkers) {
+#ifndef NDEBUG
+  std::cout << "AssetStreamer: loading " << manifest.name << std::endl;
+#endif
+  manifest.loader = std::make_unique<AssetLoader>();
+  for (const Manifest::TextureEntry& entry : manifest.textures) {
+    manifest.loader->addTexture(*entry.texture, entry.file, entry.failureMessage, entry.fallback);
+  }
+  for (const Manifest::SoundEntry& entry : manifest.sounds) {
+    manifest.loader->addSound(*entry.buffer, entry.file, entry.failureMessage, entry.fallback);
+  }
+  manifest.loader->start(maxWorkers);
+  manifest.residency = Residency::LOADING;
+}
+
+void AssetStreamer::finishLoading(Manifest& manifest, const AssetLoader::Progress& progress) {
+  // Resident even if finish() throws; the error is fatal for the caller
+  const std::unique_ptr<AssetLoader> loader = std::move(manifest.loader);
+  manifest.residency = Residency::RESIDENT;
+  loader->finish(progress);
+  if (manifest.onLoaded) {
+    manifest.onLoaded();
+  }
+}
+
+void AssetStreamer::release(Manifest& manifest) {
+#ifndef NDEBUG
+  std::cout << "AssetStreamer: releasing " << manifest.name << std::endl;
+#endif
+  // Stops the decoders before their targets are reset
+  manifest.loader.reset();
+  for (const Manifest::TextureEntry& entry : manifest.textures) {
+    *entry.texture = sf::Texture();
+  }
+  // Assigning a buffer stops and detaches the sounds playing it
+  for (const Manifest::SoundEntry& entry : manifest.sounds) {
+    *entry.buffer = sf::SoundBuffer();
+  }
+  manifest.residency = Residency::RELEASED;
+}
+
+} // namespace DP
@@ -0,0 +1,112 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+
+#include "asset-loader.h"
+
+namespace DP {
+
+/*!
+ * \brief AssetStreamer keeps only the assets of nearby game states resident
+ *
+ * Assets are grouped in manifests, each tied to the states that draw them and
+ * to the states that usually come just before. On every state change a
+ * manifest is loaded right away when the new state needs it, decoded in the
+ * background when the state may lead to it, and released otherwise. Background
+ * loads are uploaded a little every frame from update().
+ *
+ * States are plain ints so the streamer does not depend on Game.
+ */
+class AssetStreamer {
+public:
+  enum class Residency { RELEASED, LOADING, RESIDENT };
+
+  class Manifest {
+  public:
+    Manifest(const std::string& manifestName, std::set<int> neededStates,
+             std::set<int> prefetchStates);
+
+    void addTexture(sf::Texture& texture, const std::string& file,
+                    const std::string& failureMessage, AssetLoader::Fallback fallback = {});
+    void addSound(sf::SoundBuffer& buffer, const std::string& file,
+                  const std::string& failureMessage, AssetLoader::Fallback fallback = {});
+
+    // Runs on the main thread once every asset is uploaded, e.g. to reset
+    // sprite rectangles to the new texture size
+    void setOnLoaded(std::function<void()> callback) { onLoaded = std::move(callback); }
+
+    const std::string& getName() const { return name; }
+    Residency getResidency() const { return residency; }
+
+  private:
+    friend class AssetStreamer;
+
+    struct TextureEntry {
+      sf::Texture* texture;
+      std::string file;
+      std::string failureMessage;
+      AssetLoader::Fallback fallback;
+    };
+    struct SoundEntry {
+      sf::SoundBuffer* buffer;
+      std::string file;
+      std::string failureMessage;
+      AssetLoader::Fallback fallback;
+    };
+
+    std::string name;
+    std::set<int> needed;
+    std::set<int> prefetch;
+    std::vector<TextureEntry> textures;
+    std::vector<SoundEntry> sounds;
+    std::function<void()> onLoaded;
+    Residency residency;
+    std::unique_ptr<AssetLoader> loader;
+  };
+
+  AssetStreamer();
+
+  /*!
+   * \brief addManifest registers a group of assets
+   * \param neededStates States that draw the assets; entering one blocks until loaded
+   * \param prefetchStates States that may lead to one of the needed states
+   */
+  Manifest& addManifest(const std::string& name, std::set<int> neededStates,
+                        std::set<int> prefetchStates);
+
+  /*!
+   * \brief setState loads, prefetches and releases manifests for a new state
+   * Does nothing when the state did not change.
+   * \param progress Reported while blocking on needed manifests
+   * \throws DeerPortal::AssetLoadException for a needed asset without fallback
+   */
+  void setState(int state, const AssetLoader::Progress& progress = {});
+
+  /*!
+   * \brief update uploads background loads for at most about budget
+   * \throws DeerPortal::AssetLoadException once a failed manifest completes
+   */
+  void update(sf::Time budget);
+
+  bool isResident(const std::string& name) const;
+
+private:
+  // Decoder threads for prefetching, so the frame keeps most of the cores
+  static constexpr unsigned int PREFETCH_WORKERS = 2;
+
+  std::vector<std::unique_ptr<Manifest>> manifests;
+  int currentState;
+  bool hasState;
+
+  void startLoading(Manifest& manifest, unsigned int maxWorkers);
+  void finishLoading(Manifest& manifest, const AssetLoader::Progress& progress);
+  void release(Manifest& manifest);
+};
+
+} // namespace DP
@@ -1,5 +1,7 @@
 #include "banner.h"
 
+#include "draw-stats.h"
+
 Banner::Banner(sf::Font* gameFont) : active(false), textStr(""), timeDownCounter(0) {
   text = std::make_unique<sf::Text>(*gameFont);
   text->setCharacterSize(100);
@@ -41,4 +43,5 @@ void Banner::update(sf::Time frameTime) {
 void Banner::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   states.transform *= getTransform();
   target.draw(*text, states);
+  DP::DrawStats::count();
 }
@@ -1,5 +1,6 @@
 #include "board-initialization-animator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
@@ -9,6 +10,7 @@
 #endif
 
 #include "data.h"
+#include "draw-stats.h"
 #include "lighting-manager.h"
 
 void BoardInitializationAnimator::initializeAnimation(const BoardDiamondSeq& diamonds,
@@ -48,10 +50,9 @@ void BoardInitializationAnimator::initializeAnimation(const BoardDiamondSeq& dia
     // Static diamonds now use transform, so animation targets must match global coordinates
     sf::Vector2f targetPos = staticPosition + sf::Vector2f(202.f, 76.f);
 
-    // Initialize animated item with diamond's idNumber for correct sprite
-    AnimatedBoardItem item;
-    item.initialize(i, spawnPoint, targetPos, diamond.idNumber);
-    animatedItems.push_back(item);
+    // Queue animated item with diamond's idNumber for correct sprite and a
+    // precomputed staggered start time
+    animatedItems.add(spawnPoint, targetPos, diamond.idNumber, i * config.staggerDelay);
 
 #ifndef NDEBUG
     // Only debug first 3 diamonds to avoid excessive output
@@ -62,6 +63,8 @@ void BoardInitializationAnimator::initializeAnimation(const BoardDiamondSeq& dia
 #endif
   }
 
+  animationEndTime = animatedItems.getLastStartTime() + config.animationDuration;
+
   // Initialize vertex array with diamonds at spawn positions (visible)
   initializeVertexArrayAtSpawn();
 }
@@ -92,27 +95,9 @@ void BoardInitializationAnimator::update(sf::Time deltaTime) {
     return;
   }
 
-  bool allFinished = true;
-
-  // Update each animated item with staggered start times
-  for (size_t i = 0; i < animatedItems.size(); i++) {
-    float staggeredStartTime = i * config.staggerDelay;
-
-    if (totalElapsedTime >= staggeredStartTime) {
-      // Calculate effective delta time for this item
-      sf::Time effectiveDelta = sf::seconds(deltaTime.asSeconds());
-      if (totalElapsedTime - staggeredStartTime < deltaTime.asSeconds()) {
-        // First frame for this item, adjust delta time
-        effectiveDelta = sf::seconds(totalElapsedTime - staggeredStartTime);
-      }
-
-      animatedItems[i].update(effectiveDelta, config);
-    }
-
-    if (!animatedItems[i].isFinished()) {
-      allFinished = false;
-    }
-  }
+  // Evaluate every item in closed form from the shared clock
+  animatedItems.evaluate(totalElapsedTime, config);
+  const bool allFinished = totalElapsedTime >= animationEndTime;
 
   // Update vertex array with current positions
   updateVertexArray();
@@ -132,105 +117,8 @@ void BoardInitializationAnimator::update(sf::Time deltaTime) {
 }
 
 void BoardInitializationAnimator::updateVertexArray() {
-  for (size_t i = 0; i < animatedItems.size(); i++) {
-    // Render items that have started animating OR are finished (holding in position)
-    float staggeredStartTime = i * config.staggerDelay;
-    bool hasStarted = totalElapsedTime >= staggeredStartTime;
-    bool isFinished = animatedItems[i].isFinished();
-    
-    if (hasStarted || (isFinished && holdingDiamonds)) {
-      // Note: We don't have direct access to texture here,
-      // so we'll use placeholder texture coordinates
-      // The actual texture will be provided during rendering
-      int vertexOffset = i * 6; // 6 vertices per diamond (2 triangles)
-
-      sf::Vector2f position = animatedItems[i].getCurrentPosition();
-      float scale = animatedItems[i].getCurrentScale();
-      float rotation = animatedItems[i].getCurrentRotation();
-
-      // Diamond sprite size (must match BoardDiamondSeq: 35.2f = 44.0f * 0.8f)
-      float size = 35.2f * scale;
-      float halfSize = size * 0.5f;
-
-      // Calculate rotated vertices
-      float cosAngle = std::cos(rotation * M_PI / 180.0f);
-      float sinAngle = std::sin(rotation * M_PI / 180.0f);
-
-      // Define quad corners
-      sf::Vector2f corners[4] = {
-          sf::Vector2f(-halfSize, -halfSize), // Top-left
-          sf::Vector2f(halfSize, -halfSize),  // Top-right
-          sf::Vector2f(halfSize, halfSize),   // Bottom-right
-          sf::Vector2f(-halfSize, halfSize)   // Bottom-left
-      };
-
-      // Apply rotation to corners
-      sf::Vector2f rotatedCorners[4];
-      for (int j = 0; j < 4; j++) {
-        rotatedCorners[j] = sf::Vector2f(corners[j].x * cosAngle - corners[j].y * sinAngle,
-                                         corners[j].x * sinAngle + corners[j].y * cosAngle) +
-                            position;
-      }
-
-      // Define texture coordinates based on diamond's textureId
-      int textureId = animatedItems[i].getTextureId();
-      float texLeft = textureId * 44.0f;
-      float texRight = texLeft + 44.0f;
-      float texTop = 0.0f;
-      float texBottom = 44.0f;
-
-      sf::Vector2f texCoords[4] = {
-          sf::Vector2f(texLeft, texTop),     // Top-left
-          sf::Vector2f(texRight, texTop),    // Top-right
-          sf::Vector2f(texRight, texBottom), // Bottom-right
-          sf::Vector2f(texLeft, texBottom)   // Bottom-left
-      };
-
-      // Set color with alpha based on animation progress
-      float alpha = 255.0f;
-      if (hasStarted && totalElapsedTime < staggeredStartTime + 0.2f) {
-        // Fade in during first 0.2 seconds only for items that just started
-        alpha = ((totalElapsedTime - staggeredStartTime) / 0.2f) * 255.0f;
-        alpha = std::max(0.0f, std::min(255.0f, alpha));
-      }
-      sf::Color color(255, 255, 255, static_cast<std::uint8_t>(alpha));
-
-      // Create two triangles to form a quad (6 vertices total)
-      int vertexIndex = i * 6;
-
-      // First triangle: 0, 1, 2
-      animationVertices[vertexIndex + 0].position = rotatedCorners[0];
-      animationVertices[vertexIndex + 0].texCoords = texCoords[0];
-      animationVertices[vertexIndex + 0].color = color;
-
-      animationVertices[vertexIndex + 1].position = rotatedCorners[1];
-      animationVertices[vertexIndex + 1].texCoords = texCoords[1];
-      animationVertices[vertexIndex + 1].color = color;
-
-      animationVertices[vertexIndex + 2].position = rotatedCorners[2];
-      animationVertices[vertexIndex + 2].texCoords = texCoords[2];
-      animationVertices[vertexIndex + 2].color = color;
-
-      // Second triangle: 0, 2, 3
-      animationVertices[vertexIndex + 3].position = rotatedCorners[0];
-      animationVertices[vertexIndex + 3].texCoords = texCoords[0];
-      animationVertices[vertexIndex + 3].color = color;
-
-      animationVertices[vertexIndex + 4].position = rotatedCorners[2];
-      animationVertices[vertexIndex + 4].texCoords = texCoords[2];
-      animationVertices[vertexIndex + 4].color = color;
-
-      animationVertices[vertexIndex + 5].position = rotatedCorners[3];
-      animationVertices[vertexIndex + 5].texCoords = texCoords[3];
-      animationVertices[vertexIndex + 5].color = color;
-    } else {
-      // Item hasn't started yet, make it invisible
-      int vertexIndex = i * 6;
-      for (int j = 0; j < 6; j++) {
-        animationVertices[vertexIndex + j].color = sf::Color(255, 255, 255, 0);
-      }
-    }
-  }
+  if (animatedItems.empty()) return;
+  animatedItems.writeVertices(&animationVertices[0], totalElapsedTime);
 }
 
 void BoardInitializationAnimator::render(sf::RenderTarget& target,
@@ -263,97 +151,73 @@ void BoardInitializationAnimator::render(sf::RenderTarget& target,
   sf::RenderStates states;
   states.texture = &texture;
 
-  target.draw(animationVertices, states);
-}
+  if (!cullingGrid) {
+    target.draw(animationVertices, states);
+    DP::DrawStats::count();
+    return;
+  }
 
-void BoardInitializationAnimator::initializeVertexArrayAtSpawn() {
-  // Initialize all diamonds as visible at their spawn positions
-  for (size_t i = 0; i < animatedItems.size(); i++) {
-    sf::Vector2f spawnPos = animatedItems[i].getSpawnPoint();
-    float scale = 1.0f;    // Initial scale
-    float rotation = 0.0f; // Initial rotation
-
-    // Diamond sprite size (must match BoardDiamondSeq: 35.2f = 44.0f * 0.8f)
-    float size = 35.2f * scale;
-    float halfSize = size * 0.5f;
-
-    // Calculate rotated vertices
-    float cosAngle = std::cos(rotation * M_PI / 180.0f);
-    float sinAngle = std::sin(rotation * M_PI / 180.0f);
-
-    // Define quad corners
-    sf::Vector2f corners[4] = {
-        sf::Vector2f(-halfSize, -halfSize), // Top-left
-        sf::Vector2f(halfSize, -halfSize),  // Top-right
-        sf::Vector2f(halfSize, halfSize),   // Bottom-right
-        sf::Vector2f(-halfSize, halfSize)   // Bottom-left
-    };
-
-    // Apply rotation to corners
-    sf::Vector2f rotatedCorners[4];
-    for (int j = 0; j < 4; j++) {
-      rotatedCorners[j] = sf::Vector2f(corners[j].x * cosAngle - corners[j].y * sinAngle,
-                                       corners[j].x * sinAngle + corners[j].y * cosAngle) +
-                          spawnPos;
+  // Bin every quad by the cell of its centre; quads off the world get no cell
+  cullingGrid->setView(target.getView());
+  const std::size_t quadCount = animationVertices.getVertexCount() / 6;
+  quadCells.resize(quadCount);
+  float margin = 0.0f;
+  for (std::size_t quad = 0; quad < quadCount; ++quad) {
+    const std::size_t i = quad * 6;
+    sf::Vector2f minCorner = animationVertices[i].position;
+    sf::Vector2f maxCorner = minCorner;
+    for (std::size_t j = 1; j < 6; ++j) {
+      const sf::Vector2f& p = animationVertices[i + j].position;
+      minCorner.x = std::min(minCorner.x, p.x);
+      minCorner.y = std::min(minCorner.y, p.y);
+      maxCorner.x = std::max(maxCorner.x, p.x);
+      maxCorner.y = std::max(maxCorner.y, p.y);
+    }
+    const sf::Vector2f halfExtent = (maxCorner - minCorner) / 2.0f;
+    const float radius = std::max(halfExtent.x, halfExtent.y);
+    quadCells[quad] = cullingGrid->getCellIndex(minCorner + halfExtent, radius);
+    margin = std::max(margin, radius);
+  }
+  quadBins.build(quadCells, cullingGrid->getCellCount());
+
+  // Only quads in the visible cells are submitted
+  visibleVertices.clear();
+  visibleVertices.reserve(quadCount * 6);
+  sf::Vector2i first;
+  sf::Vector2i last;
+  if (cullingGrid->getVisibleCells(margin, first, last)) {
+    for (int row = first.y; row <= last.y; ++row) {
+      for (int column = first.x; column <= last.x; ++column) {
+        const int cell = row * cullingGrid->getColumns() + column;
+        for (const std::uint32_t* it = quadBins.begin(cell); it != quadBins.end(cell); ++it) {
+          for (std::size_t j = 0; j < 6; ++j) {
+            visibleVertices.push_back(animationVertices[*it * 6 + j]);
+          }
+        }
+      }
     }
+  }
 
-    // Define texture coordinates based on diamond's textureId
-    int textureId = animatedItems[i].getTextureId();
-    float texLeft = textureId * 44.0f;
-    float texRight = texLeft + 44.0f;
-    float texTop = 0.0f;
-    float texBottom = 44.0f;
-
-    sf::Vector2f texCoords[4] = {
-        sf::Vector2f(texLeft, texTop),     // Top-left
-        sf::Vector2f(texRight, texTop),    // Top-right
-        sf::Vector2f(texRight, texBottom), // Bottom-right
-        sf::Vector2f(texLeft, texBottom)   // Bottom-left
-    };
-
-    // Set color as fully visible
-    sf::Color color(255, 255, 255, 255);
-
-    // Create two triangles to form a quad (6 vertices total)
-    int vertexIndex = i * 6;
-
-    // First triangle: 0, 1, 2
-    animationVertices[vertexIndex + 0].position = rotatedCorners[0];
-    animationVertices[vertexIndex + 0].texCoords = texCoords[0];
-    animationVertices[vertexIndex + 0].color = color;
-
-    animationVertices[vertexIndex + 1].position = rotatedCorners[1];
-    animationVertices[vertexIndex + 1].texCoords = texCoords[1];
-    animationVertices[vertexIndex + 1].color = color;
-
-    animationVertices[vertexIndex + 2].position = rotatedCorners[2];
-    animationVertices[vertexIndex + 2].texCoords = texCoords[2];
-    animationVertices[vertexIndex + 2].color = color;
-
-    // Second triangle: 0, 2, 3
-    animationVertices[vertexIndex + 3].position = rotatedCorners[0];
-    animationVertices[vertexIndex + 3].texCoords = texCoords[0];
-    animationVertices[vertexIndex + 3].color = color;
-
-    animationVertices[vertexIndex + 4].position = rotatedCorners[2];
-    animationVertices[vertexIndex + 4].texCoords = texCoords[2];
-    animationVertices[vertexIndex + 4].color = color;
-
-    animationVertices[vertexIndex + 5].position = rotatedCorners[3];
-    animationVertices[vertexIndex + 5].texCoords = texCoords[3];
-    animationVertices[vertexIndex + 5].color = color;
+  if (!visibleVertices.empty()) {
+    target.draw(visibleVertices.data(), visibleVertices.size(), sf::PrimitiveType::Triangles,
+                states);
+    DP::DrawStats::count();
   }
 }
 
+void BoardInitializationAnimator::initializeVertexArrayAtSpawn() {
+  // Initialize all diamonds as visible at their spawn positions
+  if (animatedItems.empty()) return;
+  animatedItems.writeSpawnVertices(&animationVertices[0]);
+}
+
 void BoardInitializationAnimator::skipAnimation() {
   animationComplete = true;
   holdingDiamonds = false; // Don't hold diamonds when skipping - allow immediate transition
 
   // Set all items to finished state at their final positions
-  for (auto& item : animatedItems) {
-    // Force completion by updating with large time step
-    item.update(sf::seconds(config.animationDuration + 1.0f), config);
-  }
+  totalElapsedTime = animationEndTime;
+  animatedItems.evaluate(totalElapsedTime, config);
 
 #ifndef NDEBUG
   std::cout << "[DEBUG] Board initialization animation skipped, transitioning to static diamonds" << std::endl;
@@ -372,10 +236,10 @@ void BoardInitializationAnimator::updateLights(DP::LightingManager& lightingMana
   int lightCount = 0;
   
   // Add lights for each animated diamond that has started moving
-  for (const auto& item : animatedItems) {
-    if (item.getProgress() > 0.0f) {  // Includes animating and finished items
-      sf::Vector2f position = item.getCurrentPosition();
-      float scale = item.getCurrentScale();
+  for (size_t i = 0; i < animatedItems.size(); ++i) {
+    if (animatedItems.getProgress(i) > 0.0f) {  // Includes animating and finished items
+      sf::Vector2f position = animatedItems.getPosition(i);
+      float scale = animatedItems.getScale(i);
       
       // Light intensity based on diamond scale (0.3 to 1.0)
       float intensity = scale * 0.8f; // Scale down slightly for better visual effect
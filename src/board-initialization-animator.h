@@ -6,6 +6,7 @@
 #include "animated-board-item.h"
 #include "board-spawn-regions.h"
 #include "boarddiamondseq.h"
+#include "spatial-grid.h"
 
 // Forward declaration for lighting
 namespace DP {
@@ -14,14 +15,19 @@ class LightingManager;
 
 class BoardInitializationAnimator {
 private:
-  std::vector<AnimatedBoardItem> animatedItems;
+  AnimatedBoardItemBatch animatedItems;
   BoardSpawnRegions spawnRegions;
   BoardAnimationConfig config;
   sf::VertexArray animationVertices;
+  DP::SpatialGrid* cullingGrid = nullptr; // Shared broad phase, owned by Game
+  mutable std::vector<sf::Vertex> visibleVertices; // Quads in the visible cells
+  mutable std::vector<int> quadCells;               // Grid cell of each quad centre
+  mutable DP::CellBins quadBins;
   bool animationComplete = true;
   bool holdingDiamonds = false; // NEW: Hold diamonds after animation completes
   bool fadingOut = false; // NEW: Fade out dark overlay after animation
   float totalElapsedTime = 0.0f;
+  float animationEndTime = 0.0f; // Last staggered start plus duration
   float fadeOutElapsed = 0.0f;
   float fadeOutDuration = 2.0f; // 2 seconds to fade out dark overlay
 
@@ -44,6 +50,9 @@ public:
   void setAnimationConfig(const BoardAnimationConfig& newConfig) { config = newConfig; }
   const BoardAnimationConfig& getAnimationConfig() const { return config; }
   
+  // View culling: only quads in visible grid cells are submitted
+  void setCullingGrid(DP::SpatialGrid* grid) { cullingGrid = grid; }
+
   // Lighting integration
   void updateLights(DP::LightingManager& lightingManager) const;
   sf::Color getCurrentAmbientColor() const; // NEW: Get current ambient color for fade-out
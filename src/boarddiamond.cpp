@@ -1,5 +1,7 @@
 #include "boarddiamond.h"
 
+#include "draw-stats.h"
+
 BoardDiamond::BoardDiamond() {
   idNumber = 0;
   playerNumber = 0;
@@ -23,5 +25,6 @@ void BoardDiamond::draw(sf::RenderTarget& target, sf::RenderStates states) const
   if (boardPosition > -1) {
     states.transform *= getTransform();
     target.draw(*spriteHolder, states);
+    DP::DrawStats::count();
   }
 }
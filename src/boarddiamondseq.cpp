@@ -1,7 +1,10 @@
 #include "boarddiamondseq.h"
 
+#include "draw-stats.h"
+
 BoardDiamondSeq::BoardDiamondSeq(TextureHolder* textures)
-    : m_vertices(sf::PrimitiveType::Triangles, DP::diamondsNumber * 6), m_needsUpdate(true) {
+    : m_vertices(sf::PrimitiveType::Triangles, DP::diamondsNumber * 6), m_needsUpdate(true),
+      m_revision(0) {
   this->textures = textures;
   for (int i = 0; i < DP::diamondsNumber; i++) {
     diamonds[i] = BoardDiamond(this->textures, DP::DIAMONDS_SETUP[i][0], DP::DIAMONDS_SETUP[i][1],
@@ -25,6 +28,7 @@ void BoardDiamondSeq::draw(sf::RenderTarget& target, sf::RenderStates states) co
 
   // Single draw call for all 112 diamonds!
   target.draw(m_vertices, states);
+  DP::DrawStats::count();
 }
 
 void BoardDiamondSeq::updateVertexArray() const {
@@ -149,8 +153,6 @@ int BoardDiamondSeq::getRandomPos(int playerNumber) {
 }
 
 void BoardDiamondSeq::reorder() {
-  srand((unsigned)time(0));
-
   for (int element = 0; element < 4; element++) {
     int start = element;
     for (int i = start * DP::diamondsNumber / 4;
@@ -162,10 +164,10 @@ void BoardDiamondSeq::reorder() {
 
   // Mark vertex array for update after reordering
   m_needsUpdate = true;
+  m_revision++;
 }
 
 void BoardDiamondSeq::reorder(int element) {
-  srand((unsigned)time(0));
   int start = element;
   if (element == 2)
     start = 3;
@@ -182,6 +184,7 @@ void BoardDiamondSeq::reorder(int element) {
 
   // Mark vertex array for update after reordering
   m_needsUpdate = true;
+  m_revision++;
 }
 
 void BoardDiamondSeq::collectField(int pos) {
@@ -191,6 +194,7 @@ void BoardDiamondSeq::collectField(int pos) {
 
       // Mark vertex array for update after collecting diamond
       m_needsUpdate = true;
+      m_revision++;
       break;
     }
   }
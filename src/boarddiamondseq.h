@@ -45,10 +45,17 @@ public:
 
   void reorder(int element);
 
+  /*!
+   * \brief getRevision changes whenever a diamond is collected or reordered,
+   * letting cached render layers detect that the board needs redrawing.
+   */
+  unsigned int getRevision() const { return m_revision; }
+
 private:
   // PERFORMANCE OPTIMIZATION: VertexArray for batched rendering (Issue #68)
   mutable sf::VertexArray m_vertices;
   mutable bool m_needsUpdate;
+  unsigned int m_revision;
 
   // Helper methods for VertexArray optimization
   void updateVertexArray() const;
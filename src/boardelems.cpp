@@ -1,5 +1,7 @@
 #include "boardelems.h"
 
+#include "draw-stats.h"
+
 BoardElems::BoardElems() {
   active = false;
   displayNeighbours = true;
@@ -16,6 +18,7 @@ void BoardElems::draw(sf::RenderTarget& target, sf::RenderStates states) const {
 
   for (const DP::BoardElem& i : items) {
     target.draw(i, states);
+    DP::DrawStats::count();
     std::set<int> neighbours(DP::getNeighbours(i.pos));
     if ((active == true) && (displayNeighbours == true)) {
       for (int j : neighbours) {
@@ -32,6 +35,7 @@ void BoardElems::draw(sf::RenderTarget& target, sf::RenderStates states) const {
       if (items_map.count(j) == 0) {
         sf::RectangleShape sprite(DP::createNeighbour(j));
         target.draw(sprite, states);
+        DP::DrawStats::count();
       }
     }
   }
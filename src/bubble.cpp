@@ -3,26 +3,30 @@
 #include <array>
 #include <cmath>
 
+#include "draw-stats.h"
 #include "exceptions.h"
+#include "shared-assets.h"
 
 Bubble::Bubble() : state(BubbleState::DICE), timeCounter(0), posY(0) {
-  if (!textureDice.loadFromFile(get_full_path(ASSETS_PATH "img/bubble_dice.png"))) {
+  textureDice = DP::SharedAssets::getInstance().getTexture("img/bubble_dice.png");
+  if (!textureDice) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
                                          "img/bubble_dice.png",
                                          "Failed to load bubble dice texture");
   }
 
-  if (!textureFootSteps.loadFromFile(get_full_path(ASSETS_PATH "img/bubble_footsteps.png"))) {
+  textureFootSteps = DP::SharedAssets::getInstance().getTexture("img/bubble_footsteps.png");
+  if (!textureFootSteps) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
                                          "img/bubble_footsteps.png",
                                          "Failed to load bubble footsteps texture");
   }
 
-  spriteDice = std::make_unique<sf::Sprite>(textureDice);
-  spriteFootSteps = std::make_unique<sf::Sprite>(textureFootSteps);
+  spriteDice = std::make_unique<sf::Sprite>(*textureDice);
+  spriteFootSteps = std::make_unique<sf::Sprite>(*textureFootSteps);
 
-  spritesBubbles[0] = std::make_unique<sf::Sprite>(textureDice);
-  spritesBubbles[1] = std::make_unique<sf::Sprite>(textureFootSteps);
+  spritesBubbles[0] = std::make_unique<sf::Sprite>(*textureDice);
+  spritesBubbles[1] = std::make_unique<sf::Sprite>(*textureFootSteps);
 }
 
 void Bubble::setPosition(float x, float y) {
@@ -33,6 +37,7 @@ void Bubble::setPosition(float x, float y) {
 void Bubble::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   states.transform *= getTransform();
   target.draw(*spritesBubbles[state], states);
+  DP::DrawStats::count();
 }
 
 void Bubble::update(sf::Time deltaTime) {
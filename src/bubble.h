@@ -15,8 +15,8 @@ public:
   Bubble();
 
 public:
-  sf::Texture textureDice;
-  sf::Texture textureFootSteps;
+  std::shared_ptr<const sf::Texture> textureDice;
+  std::shared_ptr<const sf::Texture> textureFootSteps;
   std::unique_ptr<sf::Sprite> spriteDice;
   std::unique_ptr<sf::Sprite> spriteFootSteps;
 
@@ -2,10 +2,81 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <sstream>
 
+#include "draw-stats.h"
+
+namespace {
+// Card type names in TextureHolder::cardsTextures column order
+const char* const CARD_TYPES[4] = {"stop", "card", "diamond", "diamond x 2"};
+
+void appendQuad(std::vector<sf::Vertex>& vertices, const sf::Transform& transform,
+                const sf::FloatRect& rect, const sf::FloatRect& texRect, sf::Color color) {
+  const sf::Vector2f topLeft = transform.transformPoint(rect.position);
+  const sf::Vector2f topRight =
+      transform.transformPoint(rect.position + sf::Vector2f(rect.size.x, 0.0f));
+  const sf::Vector2f bottomLeft =
+      transform.transformPoint(rect.position + sf::Vector2f(0.0f, rect.size.y));
+  const sf::Vector2f bottomRight = transform.transformPoint(rect.position + rect.size);
+
+  const sf::Vector2f uvTopLeft = texRect.position;
+  const sf::Vector2f uvTopRight = texRect.position + sf::Vector2f(texRect.size.x, 0.0f);
+  const sf::Vector2f uvBottomLeft = texRect.position + sf::Vector2f(0.0f, texRect.size.y);
+  const sf::Vector2f uvBottomRight = texRect.position + texRect.size;
+
+  vertices.push_back(sf::Vertex{topLeft, color, uvTopLeft});
+  vertices.push_back(sf::Vertex{topRight, color, uvTopRight});
+  vertices.push_back(sf::Vertex{bottomLeft, color, uvBottomLeft});
+  vertices.push_back(sf::Vertex{bottomLeft, color, uvBottomLeft});
+  vertices.push_back(sf::Vertex{topRight, color, uvTopRight});
+  vertices.push_back(sf::Vertex{bottomRight, color, uvBottomRight});
+}
+
+// Shapes a single-line sf::Text into glyph quads the same way sf::Text does
+// (regular style, default spacing), in the text's own transform
+void appendTextQuads(std::vector<sf::Vertex>& vertices, const sf::Text& text) {
+  const sf::Font& font = text.getFont();
+  const unsigned int size = text.getCharacterSize();
+  const sf::String& string = text.getString();
+  const sf::Transform& transform = text.getTransform();
+  const sf::Color color = text.getFillColor();
+  const float whitespaceWidth = font.getGlyph(U' ', size, false).advance;
+  const float padding = 1.0f; // Same glyph padding as sf::Text
+
+  float x = 0.0f;
+  const float y = static_cast<float>(size);
+  std::uint32_t previous = 0;
+  for (std::size_t i = 0; i < string.getSize(); ++i) {
+    const std::uint32_t current = string[i];
+    x += font.getKerning(previous, current, size, false);
+    previous = current;
+
+    if (current == U' ') {
+      x += whitespaceWidth;
+      continue;
+    }
+    if (current == U'\t') {
+      x += whitespaceWidth * 4;
+      continue;
+    }
+
+    const sf::Glyph& glyph = font.getGlyph(current, size, false);
+    const sf::FloatRect rect(
+        sf::Vector2f(x + glyph.bounds.position.x - padding, y + glyph.bounds.position.y - padding),
+        glyph.bounds.size + sf::Vector2f(padding * 2, padding * 2));
+    const sf::FloatRect texRect(
+        sf::Vector2f(glyph.textureRect.position) - sf::Vector2f(padding, padding),
+        sf::Vector2f(glyph.textureRect.size) + sf::Vector2f(padding * 2, padding * 2));
+    appendQuad(vertices, transform, rect, texRect, color);
+    x += glyph.advance;
+  }
+}
+} // namespace
+
 CardNotification::CardNotification(sf::Font* gameFont, TextureHolder* textures)
-    : font(gameFont), textures(textures), active(false), blinkTimer(0.0f) {
+    : font(gameFont), textures(textures), currentLayout(nullptr), active(false),
+      blinkTimer(0.0f) {
   notificationText = std::make_unique<sf::Text>(*font);
   notificationText->setCharacterSize(TEXT_SIZE);
   notificationText->setFillColor(sf::Color::White);
@@ -33,8 +104,24 @@ CardNotification::CardNotification(sf::Font* gameFont, TextureHolder* textures)
 
 void CardNotification::showCardNotification(const std::string& cardType, int playerNumber,
                                             int targetPlayer, int cardPileNumber) {
-  std::string notificationMessage = generateNotificationText(cardType, playerNumber, targetPlayer);
-  setupNotification(notificationMessage, playerNumber, targetPlayer, cardPileNumber);
+  const int cardTypeIndex = getCardTypeIndex(cardType);
+  if (textures && cardTypeIndex >= 0 && playerNumber >= 0 && playerNumber < 4) {
+    // Known combination: reuse the finished layout, only the card face varies
+    const Layout& layout = getLayout(cardTypeIndex, playerNumber, targetPlayer);
+    if (cardPileNumber >= 0 && cardPileNumber < 4) {
+      cardSprite->setTexture(textures->cardsTextures[cardPileNumber][cardTypeIndex]);
+    }
+    cardSprite->setPosition(layout.cardPosition);
+    backgroundRect->setSize(layout.backgroundSize);
+    backgroundRect->setPosition(layout.backgroundPosition);
+    currentLayout = &layout;
+  } else {
+    // Unknown card types and text-only mode are laid out on the fly
+    currentLayout = nullptr;
+    std::string notificationMessage =
+        generateNotificationText(cardType, playerNumber, targetPlayer);
+    setupNotification(notificationMessage, playerNumber, targetPlayer, cardPileNumber);
+  }
 
   active = true;
   blinkTimer = 0.0f;
@@ -45,6 +132,83 @@ void CardNotification::dismiss() {
   blinkTimer = 0.0f;
 }
 
+void CardNotification::precomputeLayouts() {
+  if (!textures) return;
+
+  for (int cardTypeIndex = 0; cardTypeIndex < 4; cardTypeIndex++) {
+    for (int playerNumber = 0; playerNumber < 4; playerNumber++) {
+      for (int targetPlayer = -1; targetPlayer < 4; targetPlayer++) {
+        getLayout(cardTypeIndex, playerNumber, targetPlayer);
+      }
+    }
+  }
+}
+
+int CardNotification::getCardTypeIndex(const std::string& cardType) {
+  for (int i = 0; i < 4; i++) {
+    if (cardType == CARD_TYPES[i]) return i;
+  }
+  return -1;
+}
+
+const CardNotification::Layout& CardNotification::getLayout(int cardTypeIndex, int playerNumber,
+                                                            int targetPlayer) {
+  // Targeting yourself reads the same as having no target
+  if (targetPlayer < 0 || targetPlayer >= 4 || targetPlayer == playerNumber) {
+    targetPlayer = -1;
+  }
+
+  std::unique_ptr<Layout>& layout =
+      layouts[(cardTypeIndex * 4 + playerNumber) * LAYOUT_TARGETS + targetPlayer + 1];
+  if (!layout) {
+    layout = buildLayout(cardTypeIndex, playerNumber, targetPlayer);
+  }
+  return *layout;
+}
+
+std::unique_ptr<CardNotification::Layout>
+CardNotification::buildLayout(int cardTypeIndex, int playerNumber, int targetPlayer) {
+  // All small card textures share one size, so the pile does not affect the
+  // layout and the card sprite keeps whatever face it currently has
+  const std::string text =
+      generateNotificationText(CARD_TYPES[cardTypeIndex], playerNumber, targetPlayer);
+  setupNotification(text, playerNumber, targetPlayer, -1);
+
+  auto layout = std::make_unique<Layout>();
+  layout->backgroundPosition = backgroundRect->getPosition();
+  layout->backgroundSize = backgroundRect->getSize();
+  layout->cardPosition = cardSprite->getPosition();
+
+  auto glyphBatchFor = [&layout](unsigned int characterSize) -> std::vector<sf::Vertex>& {
+    for (auto& batch : layout->glyphBatches) {
+      if (batch.characterSize == characterSize) return batch.vertices;
+    }
+    layout->glyphBatches.push_back(Layout::GlyphBatch{characterSize, {}});
+    return layout->glyphBatches.back().vertices;
+  };
+
+  for (const auto& textSeg : textSegments) {
+    if (textSeg->getString() == "LINEBREAK") continue;
+    appendTextQuads(glyphBatchFor(textSeg->getCharacterSize()), *textSeg);
+  }
+  for (const auto& label : inlineLabels) {
+    appendTextQuads(glyphBatchFor(label->getCharacterSize()), *label);
+  }
+  for (const auto& portrait : inlinePortraits) {
+    const sf::IntRect& rect = portrait->getTextureRect();
+    const sf::Vector2f size(rect.size);
+    appendQuad(layout->portraitVertices, portrait->getTransform(),
+               sf::FloatRect(sf::Vector2f(0.0f, 0.0f), size),
+               sf::FloatRect(sf::Vector2f(rect.position), size), portrait->getColor());
+  }
+
+  // The shaped layout replaces the temporary text objects
+  textSegments.clear();
+  inlinePortraits.clear();
+  inlineLabels.clear();
+  return layout;
+}
+
 std::string CardNotification::generateNotificationText(const std::string& cardType,
                                                        int playerNumber, int targetPlayer) {
   std::stringstream message;
@@ -575,6 +739,7 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
 
     // Draw semi-transparent background first
     target.draw(*backgroundRect, states);
+    DP::DrawStats::count();
 
     // Draw card sprite if available
     if (textures && cardSprite) {
@@ -582,12 +747,19 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
       cardColor.a = static_cast<std::uint8_t>(255 * alpha);
       cardSprite->setColor(cardColor);
       target.draw(*cardSprite, states);
+      DP::DrawStats::count();
       cardColor.a = 255;
       cardSprite->setColor(cardColor);
     }
 
-    // Draw inline layout elements
-    if (textures && !textSegments.empty()) {
+    if (currentLayout) {
+      for (const auto& batch : currentLayout->glyphBatches) {
+        drawBatch(target, states, batch.vertices, &font->getTexture(batch.characterSize), alpha);
+      }
+      drawBatch(target, states, currentLayout->portraitVertices, &textures->textureCharacters,
+                alpha);
+    } else if (textures && !textSegments.empty()) {
+      // Draw inline layout elements
       // Draw all text segments
       for (const auto& textSeg : textSegments) {
         // Skip LINEBREAK markers
@@ -599,6 +771,7 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
         textColor.a = static_cast<std::uint8_t>(255 * alpha);
         textSeg->setFillColor(textColor);
         target.draw(*textSeg, states);
+        DP::DrawStats::count();
         textColor.a = 255;
         textSeg->setFillColor(textColor);
       }
@@ -609,6 +782,7 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
         portraitColor.a = static_cast<std::uint8_t>(255 * alpha);
         portrait->setColor(portraitColor);
         target.draw(*portrait, states);
+        DP::DrawStats::count();
         portraitColor.a = 255;
         portrait->setColor(portraitColor);
       }
@@ -619,6 +793,7 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
         labelColor.a = static_cast<std::uint8_t>(255 * alpha);
         label->setFillColor(labelColor);
         target.draw(*label, states);
+        DP::DrawStats::count();
         labelColor.a = 255;
         label->setFillColor(labelColor);
       }
@@ -628,6 +803,7 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
       textColor.a = static_cast<std::uint8_t>(255 * alpha);
       notificationText->setFillColor(textColor);
       target.draw(*notificationText, states);
+      DP::DrawStats::count();
       textColor.a = 255;
       notificationText->setFillColor(textColor);
     }
@@ -638,6 +814,28 @@ void CardNotification::draw(sf::RenderTarget& target, sf::RenderStates states) c
   }
 }
 
+void CardNotification::drawBatch(sf::RenderTarget& target, sf::RenderStates states,
+                                 const std::vector<sf::Vertex>& vertices,
+                                 const sf::Texture* texture, float alpha) const {
+  if (vertices.empty()) return;
+
+  states.texture = texture;
+  if (alpha >= 1.0f) {
+    target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states);
+    DP::DrawStats::count();
+    return;
+  }
+
+  // Baked vertices are opaque white; fade a copy in the reused scratch buffer
+  fadedVertices.assign(vertices.begin(), vertices.end());
+  const std::uint8_t fadedAlpha = static_cast<std::uint8_t>(255 * alpha);
+  for (sf::Vertex& vertex : fadedVertices) {
+    vertex.color.a = fadedAlpha;
+  }
+  target.draw(fadedVertices.data(), fadedVertices.size(), sf::PrimitiveType::Triangles, states);
+  DP::DrawStats::count();
+}
+
 void CardNotification::setupCardSprite(const std::string& text, int cardPileNumber) {
   if (!textures || !cardSprite || cardPileNumber < 0 || cardPileNumber >= 4) return;
 
@@ -654,17 +852,7 @@ void CardNotification::setupCardSprite(const std::string& text, int cardPileNumb
     cardType = "card";
   }
 
-  // Map card type strings to indices
-  int cardTypeIndex = -1;
-  if (cardType == "stop") {
-    cardTypeIndex = 0;
-  } else if (cardType == "card") {
-    cardTypeIndex = 1;
-  } else if (cardType == "diamond") {
-    cardTypeIndex = 2;
-  } else if (cardType == "diamond x 2") {
-    cardTypeIndex = 3;
-  }
+  int cardTypeIndex = getCardTypeIndex(cardType);
 
   if (cardTypeIndex >= 0 && cardTypeIndex < 4) {
     // Set the appropriate card texture based on pile number and card type
@@ -1,8 +1,10 @@
 #ifndef CARDNOTIFICATION_H
 #define CARDNOTIFICATION_H
 
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <SFML/Graphics.hpp>
 
@@ -44,9 +46,57 @@ public:
    */
   bool isActive() const { return active; }
 
+  /*!
+   * \brief Builds the layout of every known card/player/target combination
+   * Call once the font is loaded so the first notification does no text shaping
+   */
+  void precomputeLayouts();
+
 private:
+  /*!
+   * \brief A finished notification layout
+   * Text is stored as pre-shaped glyph quads per character size and the inline
+   * portraits as one quad batch, so showing and drawing it needs no sf::Text.
+   */
+  struct Layout {
+    struct GlyphBatch {
+      unsigned int characterSize = 0;
+      std::vector<sf::Vertex> vertices;
+    };
+
+    sf::Vector2f backgroundPosition;
+    sf::Vector2f backgroundSize;
+    sf::Vector2f cardPosition;
+    std::vector<GlyphBatch> glyphBatches;
+    std::vector<sf::Vertex> portraitVertices;
+  };
+
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
+  /*!
+   * \brief Maps a card type name to its column in TextureHolder::cardsTextures
+   * \return 0-3, or -1 for unknown card types
+   */
+  static int getCardTypeIndex(const std::string& cardType);
+
+  /*!
+   * \brief Returns the cached layout for a combination, building it on first use
+   * Players and targets must be 0-3; any other target means "no target"
+   */
+  const Layout& getLayout(int cardTypeIndex, int playerNumber, int targetPlayer);
+
+  /*!
+   * \brief Runs the inline layout once and bakes the result into a Layout
+   */
+  std::unique_ptr<Layout> buildLayout(int cardTypeIndex, int playerNumber, int targetPlayer);
+
+  /*!
+   * \brief Draws a baked vertex batch, fading it for the blink effect if needed
+   */
+  void drawBatch(sf::RenderTarget& target, sf::RenderStates states,
+                 const std::vector<sf::Vertex>& vertices, const sf::Texture* texture,
+                 float alpha) const;
+
   /*!
    * \brief Generates notification text based on card type and context
    * \param cardType The type of card
@@ -116,6 +166,12 @@ private:
   std::vector<std::unique_ptr<sf::Sprite>> inlinePortraits;
   std::vector<std::unique_ptr<sf::Text>> inlineLabels;
 
+  // Memoized layouts indexed by card type, player and target (-1 to 3)
+  static constexpr int LAYOUT_TARGETS = 5;
+  std::array<std::unique_ptr<Layout>, 4 * 4 * LAYOUT_TARGETS> layouts;
+  const Layout* currentLayout;
+  mutable std::vector<sf::Vertex> fadedVertices; // Scratch buffer for the blink fade
+
   // State management
   bool active;
   float blinkTimer; // For visual feedback (optional blinking effect)
@@ -1,6 +1,9 @@
 #include "cardsdeck.h"
 
-CardsDeck::CardsDeck(TextureHolder* textures, sf::Font* gameFont, Command* command) {
+#include "draw-stats.h"
+
+CardsDeck::CardsDeck(TextureHolder* textures, sf::Font* gameFont, Command* command)
+    : revision(0) {
   commandManager = command;
   std::array<std::array<int, 2>, 4> cardsPos = {
       {{{1087, 95}}, {{1225, 95}}, {{1225, 277}}, {{1087, 277}}}};
@@ -38,7 +41,9 @@ void CardsDeck::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   for (int i = 0; i <= 3; i++) {
     if ((cardsList[i].invisibleLeft == 0.0f) && (cardsList[i].active)) {
       target.draw(*spriteCardBases[i], states);
+      DP::DrawStats::count();
       target.draw(*textPileTitle[i], states);
+      DP::DrawStats::count();
     }
   }
 }
@@ -50,6 +55,7 @@ void CardsDeck::setTitles(int number) {
   //        int val = getCardTypeInt(number);
 
   spriteCardBases[number]->setTexture(textures->cardsTextures[number][cardTypeInt]);
+  revision++;
 }
 
 void CardsDeck::setFonts(sf::Font* gameFont) {
@@ -61,6 +67,7 @@ void CardsDeck::setFonts(sf::Font* gameFont) {
 void CardsDeck::nextCard(int pileNumber) {
   if (cardsList[pileNumber].active) {
     cardsList[pileNumber].invisibleLeft = 0.75f;
+    revision++;
     unsigned int currentCard = getCurrentCard(pileNumber);
 
     if (currentCard >= DP::cardsDistribution.size() - 1) {
@@ -99,6 +106,7 @@ void CardsDeck::update(sf::Time deltaTime) {
     }
     if (cardsList[i].invisibleLeft < 0.0f) {
       cardsList[i].invisibleLeft = 0.0f;
+      revision++; // Pile becomes visible again
     }
   }
 }
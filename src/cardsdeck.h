@@ -30,6 +30,14 @@ public:
   int getCardTypeInt(int pileNumber);
   void setTitles(int number);
   void reloadCards();
+
+  /*!
+   * \brief getRevision changes whenever the visible state of any pile changes
+   */
+  unsigned int getRevision() const { return revision; }
+
+private:
+  unsigned int revision;
 };
 
 #endif // CARDSDECK_H
@@ -1,5 +1,7 @@
 #include "cardslist.h"
 
+#include <cstdlib>
+
 CardsList::CardsList() : currentCard(0), element(0), invisibleLeft(0), active(true) {}
 
 CardsList::CardsList(int element) : active(true) {
@@ -11,8 +13,8 @@ CardsList::CardsList(int element) : active(true) {
 
 void CardsList::shufflePile() {
   active = true;
-  std::srand(std::time(0));
-  unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
+  // Drawn from the process-wide std::rand seed so a seeded run shuffles the same way
+  const unsigned seed = static_cast<unsigned>(std::rand());
 
   shuffle(cardsPile.begin(), cardsPile.end(), std::default_random_engine(seed));
 }
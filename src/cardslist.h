@@ -1,7 +1,6 @@
 #ifndef CARDSLIST_H
 #define CARDSLIST_H
 #include <algorithm> // std::shuffle
-#include <chrono>    // std::chrono::system_clock
 #include <ctime>
 #include <iostream> // std::cout
 #include <random>   // std::default_random_engine
@@ -108,7 +108,7 @@ void Command::processField(int pos) {
   if ((startField) && (DP::startPlayers[game.turn] == pos)) {
     game.banner.setText("meditation");
     game.boardDiamonds.reorder(game.turn);
-    game.sfx.soundMeditation.play();
+    game.sfx.playMeditation();
   }
 
   // Hide big diamond when player enters center position (like in 0.8.2)
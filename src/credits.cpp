@@ -3,6 +3,8 @@
 #include <array>
 #include <iostream>
 
+#include "draw-stats.h"
+
 Credits::Credits(sf::Font* gameFont) {
   text = std::make_unique<sf::Text>(*gameFont);
   timeDownCounter = 0;
@@ -50,6 +52,7 @@ void Credits::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   if (txtState != state_nothing) {
     states.transform *= getTransform();
     target.draw(*text, states);
+    DP::DrawStats::count();
   }
 }
 
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+
+namespace DP {
+
+/*!
+ * \brief DrawStats counts the draw calls submitted while rendering a frame
+ *
+ * Every site that hands a leaf primitive (sprite, text, shape, vertex array
+ * or vertex buffer) to an sf::RenderTarget bumps the counter once, which is
+ * one GL draw call in SFML (two for outlined text and shapes). Composite game
+ * drawables are not counted themselves; their draw() counts the leaves it
+ * submits. deerportal-renderbench resets and reads it every frame.
+ */
+class DrawStats {
+public:
+  static void count(std::size_t calls = 1) { drawCalls += calls; }
+  static std::size_t getDrawCalls() { return drawCalls; }
+  static void reset() { drawCalls = 0; }
+
+private:
+  inline static std::size_t drawCalls = 0;
+};
+
+} // namespace DP
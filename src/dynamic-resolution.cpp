@@ -0,0 +1,82 @@
+#include "dynamic-resolution.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace DP {
+
+DynamicResolution::DynamicResolution()
+  : enabled(true)
+  , minimumScale(0.5f)
+  , scale(1.0f)
+  , workEmaMs(0.0f)
+  , framesOver(0)
+  , framesUnder(0)
+  , cooldown(0) {}
+
+void DynamicResolution::setEnabled(bool newEnabled) {
+  enabled = newEnabled;
+  if (!enabled) {
+    reset();
+  }
+}
+
+void DynamicResolution::setMinimumScale(float newScale) {
+  minimumScale = std::min(1.0f, std::max(0.25f, newScale));
+  scale = std::max(scale, minimumScale);
+}
+
+void DynamicResolution::reset() {
+  scale = 1.0f;
+  workEmaMs = 0.0f;
+  framesOver = 0;
+  framesUnder = 0;
+  cooldown = 0;
+}
+
+bool DynamicResolution::addFrame(float workMs, float budgetMs) {
+  if (!enabled || budgetMs <= 0.0f) {
+    return false;
+  }
+
+  workEmaMs = workEmaMs == 0.0f ? workMs : workEmaMs + (workMs - workEmaMs) * 0.1f;
+
+  // Let the smoothed cost settle at the new resolution first
+  if (cooldown > 0) {
+    --cooldown;
+    return false;
+  }
+
+  if (workEmaMs > budgetMs * HIGH_WATER) {
+    ++framesOver;
+    framesUnder = 0;
+  } else if (workEmaMs < budgetMs * LOW_WATER) {
+    ++framesUnder;
+    framesOver = 0;
+  } else {
+    framesOver = 0;
+    framesUnder = 0;
+  }
+
+  float newScale = scale;
+  if (framesOver >= FRAMES_BEFORE_DOWN && scale > minimumScale) {
+    newScale = std::max(minimumScale, scale - STEP_DOWN);
+  } else if (framesUnder >= FRAMES_BEFORE_UP && scale < 1.0f) {
+    newScale = std::min(1.0f, scale + STEP_UP);
+  }
+  if (newScale == scale) {
+    return false;
+  }
+
+#ifndef NDEBUG
+  std::cout << "DynamicResolution: scale " << scale << " -> " << newScale << " (work "
+            << workEmaMs << " ms, budget " << budgetMs << " ms)" << std::endl;
+#endif
+  scale = newScale;
+  framesOver = 0;
+  framesUnder = 0;
+  cooldown = COOLDOWN_FRAMES;
+  return true;
+}
+
+} // namespace DP
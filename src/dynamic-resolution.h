@@ -0,0 +1,60 @@
+#pragma once
+
+namespace DP {
+
+/*!
+ * \brief DynamicResolution picks the scene render scale from measured frame cost
+ *
+ * Fed with the work time of every frame (update + draw + submit, without the
+ * pacing wait). When the smoothed cost stays above the budget for a while the
+ * scale steps down; when it stays well below, it steps back up. The gap
+ * between the two thresholds, the longer wait before scaling up and a cooldown
+ * after every change keep the scale from oscillating, which matters because
+ * each change reallocates the scene texture.
+ */
+class DynamicResolution {
+public:
+  DynamicResolution();
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return enabled; }
+
+  /*!
+   * \brief setMinimumScale limits how far the scene may be scaled down
+   * \param scale Fraction of the native resolution per axis, 0.25 - 1
+   */
+  void setMinimumScale(float scale);
+  float getMinimumScale() const { return minimumScale; }
+
+  /*!
+   * \brief addFrame records one frame
+   * \param workMs Time the frame took before pacing
+   * \param budgetMs Frame time the game aims for
+   * \return true when the scale changed and the scene target must be resized
+   */
+  bool addFrame(float workMs, float budgetMs);
+
+  float getScale() const { return scale; }
+
+  // Back to native resolution, e.g. after the window was recreated
+  void reset();
+
+private:
+  static constexpr float STEP_DOWN = 0.1f;
+  static constexpr float STEP_UP = 0.05f;
+  static constexpr float HIGH_WATER = 0.8f; // Below FramePacer's 0.9 so this reacts first
+  static constexpr float LOW_WATER = 0.55f;
+  static constexpr int FRAMES_BEFORE_DOWN = 10;
+  static constexpr int FRAMES_BEFORE_UP = 120;
+  static constexpr int COOLDOWN_FRAMES = 30;
+
+  bool enabled;
+  float minimumScale;
+  float scale;
+  float workEmaMs;
+  int framesOver;
+  int framesUnder;
+  int cooldown;
+};
+
+} // namespace DP
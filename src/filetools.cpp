@@ -0,0 +1,147 @@
+#include "filetools.h"
+
+#include <cstdlib>
+#include <filesystem>
+
+#ifdef __APPLE__
+#include <libgen.h>
+#include <unistd.h>
+
+#include <mach-o/dyld.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+
+#include <sys/stat.h>
+#endif
+
+#include "profiler.h"
+
+namespace DP {
+
+namespace {
+std::string findBase() {
+  if (getenv("DP_DIR") != NULL) {
+    return std::string(getenv("DP_DIR"));
+  }
+
+  // Check for AppImage APPDIR environment variable
+  if (getenv("APPDIR") != NULL) {
+    // For AppImage, assets should be in usr/share/games/deerportal/
+    return std::string(getenv("APPDIR")) + "/usr/share/games/deerportal/";
+  }
+
+  // Check if we're running from a Linux installation (tar.gz package)
+  // Look for assets in standard Linux location relative to binary
+#ifdef __linux__
+  char exec_path[1024];
+  ssize_t count = readlink("/proc/self/exe", exec_path, sizeof(exec_path) - 1);
+  if (count != -1) {
+    exec_path[count] = '\0';
+    std::string exec_dir = std::string(exec_path);
+
+    // Remove executable name to get directory
+    size_t pos = exec_dir.find_last_of('/');
+    if (pos != std::string::npos) {
+      exec_dir = exec_dir.substr(0, pos);
+
+      // Check if we're in /usr/bin or similar - look for ../share/games/deerportal/
+      struct stat st;
+      std::string assets_dir = exec_dir + "/../share/games/deerportal/assets";
+      if (stat(assets_dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        return exec_dir + "/../share/games/deerportal/";
+      }
+    }
+  }
+#endif
+
+#ifdef __APPLE__
+  // On macOS, detect if we're running from an app bundle
+  char exec_path[1024];
+  uint32_t size = sizeof(exec_path);
+  if (_NSGetExecutablePath(exec_path, &size) == 0) {
+    // Convert to absolute path
+    char* abs_path = realpath(exec_path, nullptr);
+    if (abs_path) {
+      std::string exec_dir = std::string(abs_path);
+      free(abs_path);
+
+      // Check if we're in an app bundle (path contains .app/Contents/MacOS)
+      size_t pos = exec_dir.find(".app/Contents/MacOS");
+      if (pos != std::string::npos) {
+        // Extract bundle path and point to Resources
+        return exec_dir.substr(0, pos + 4) + "/Contents/Resources/";
+      }
+    }
+  }
+#endif
+
+  return std::string();
+}
+
+const std::vector<std::string>& defaultSearchPaths() {
+  static const std::vector<std::string> paths = {".", "./assets", "../assets",
+                                                 "./Resources", // macOS app bundle
+                                                 "../Resources"};
+  return paths;
+}
+} // namespace
+
+AssetPaths& AssetPaths::getInstance() {
+  static AssetPaths instance;
+  return instance;
+}
+
+AssetPaths::AssetPaths() : searchPaths(defaultSearchPaths()) {
+  DP_PROFILE_ZONE("AssetPaths::AssetPaths");
+  base = findBase();
+#ifndef NDEBUG
+  std::cout << "AssetPaths: base '" << base << "'" << std::endl;
+#endif
+}
+
+std::string AssetPaths::find(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto cached = found.find(path);
+  if (cached != found.end()) {
+    return cached->second;
+  }
+
+  std::string result = resolve(path);
+  if (!fileExists(result)) {
+    for (const std::string& searchPath : searchPaths) {
+      const std::string candidate = searchPath + "/" + path;
+      if (fileExists(candidate)) {
+        result = candidate;
+        break;
+      }
+    }
+  }
+  found.emplace(path, result);
+  return result;
+}
+
+void AssetPaths::addSearchPath(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex);
+  searchPaths.push_back(path);
+  // Misses may be found now
+  found.clear();
+}
+
+void AssetPaths::resetSearchPaths() {
+  std::lock_guard<std::mutex> lock(mutex);
+  searchPaths = defaultSearchPaths();
+  found.clear();
+}
+
+bool AssetPaths::fileExists(const std::string& path) {
+  std::error_code error;
+  return std::filesystem::is_regular_file(path, error);
+}
+
+} // namespace DP
+
+std::string get_full_path(const std::string& path) {
+  return DP::AssetPaths::getInstance().resolve(path);
+}
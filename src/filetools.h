@@ -2,87 +2,54 @@
 #define FILETOOLS_H
 
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
-#ifdef __APPLE__
-#include <libgen.h>
-#include <unistd.h>
+namespace DP {
 
-#include <mach-o/dyld.h>
-#endif
+/*!
+ * \brief AssetPaths finds the game data directory once per run
+ *
+ * The base directory (DP_DIR, the AppImage, a Linux install prefix or the
+ * macOS bundle) is resolved on first use instead of on every asset request.
+ * Files looked up through the search paths are remembered, so a repeated
+ * lookup costs one hash map access. Safe to use from the asset decoders.
+ */
+class AssetPaths {
+public:
+  static AssetPaths& getInstance();
 
-#ifdef __linux__
-#include <unistd.h>
+  // Prefix of all data paths; empty when running from the source tree
+  const std::string& getBase() const { return base; }
 
-#include <sys/stat.h>
-#endif
+  std::string resolve(const std::string& path) const { return base + path; }
 
-static std::string get_full_path(std::string path) {
-  std::string new_path;
-  if (getenv("DP_DIR") != NULL) {
-    new_path = std::string(getenv("DP_DIR")) + path;
-    return new_path;
-  }
+  /*!
+   * \brief find returns the first existing location of a file
+   * Tries the base directory and then the search paths; without a match it
+   * returns resolve(path).
+   */
+  std::string find(const std::string& path);
 
-  // Check for AppImage APPDIR environment variable
-  if (getenv("APPDIR") != NULL) {
-    std::string appdir = std::string(getenv("APPDIR"));
-    // For AppImage, assets should be in usr/share/games/deerportal/
-    new_path = appdir + "/usr/share/games/deerportal/" + path;
-    return new_path;
-  }
+  void addSearchPath(const std::string& path);
+  void resetSearchPaths(); // Back to the default search paths
 
-  // Check if we're running from a Linux installation (tar.gz package)
-  // Look for assets in standard Linux location relative to binary
-#ifdef __linux__
-  // Get executable directory
-  char exec_path[1024];
-  ssize_t count = readlink("/proc/self/exe", exec_path, sizeof(exec_path) - 1);
-  if (count != -1) {
-    exec_path[count] = '\0';
-    std::string exec_dir = std::string(exec_path);
+  static bool fileExists(const std::string& path);
 
-    // Remove executable name to get directory
-    size_t pos = exec_dir.find_last_of('/');
-    if (pos != std::string::npos) {
-      exec_dir = exec_dir.substr(0, pos);
+private:
+  AssetPaths();
 
-      // Check if we're in /usr/bin or similar - look for ../share/games/deerportal/
-      std::string assets_path = exec_dir + "/../share/games/deerportal/" + path;
+  std::string base;
+  std::vector<std::string> searchPaths;
+  std::unordered_map<std::string, std::string> found;
+  std::mutex mutex;
+};
 
-      // Verify the assets directory exists
-      struct stat st;
-      std::string assets_dir = exec_dir + "/../share/games/deerportal/assets";
-      if (stat(assets_dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
-        return assets_path;
-      }
-    }
-  }
-#endif
+} // namespace DP
 
-#ifdef __APPLE__
-  // On macOS, detect if we're running from an app bundle
-  char exec_path[1024];
-  uint32_t size = sizeof(exec_path);
-  if (_NSGetExecutablePath(exec_path, &size) == 0) {
-    // Convert to absolute path
-    char* abs_path = realpath(exec_path, nullptr);
-    if (abs_path) {
-      std::string exec_dir = std::string(abs_path);
-      free(abs_path);
+// Full path of a data file, e.g. get_full_path(ASSETS_PATH "img/deer-god.png")
+std::string get_full_path(const std::string& path);
 
-      // Check if we're in an app bundle (path contains .app/Contents/MacOS)
-      if (exec_dir.find(".app/Contents/MacOS") != std::string::npos) {
-        // Extract bundle path and point to Resources
-        size_t pos = exec_dir.find(".app/Contents/MacOS");
-        std::string bundle_path = exec_dir.substr(0, pos + 4); // include .app
-        new_path = bundle_path + "/Contents/Resources/" + path;
-        return new_path;
-      }
-    }
-  }
-#endif
-
-  return path;
-}
 #endif // FILETOOLS_H
@@ -0,0 +1,172 @@
+#include "frame-pacer.h"
+#include <algorithm>
+#include <iostream>
+
+#include "profiler.h"
+
+namespace DP {
+
+namespace {
+// Fractions of the target rate used by the adaptive mode
+constexpr float ADAPTIVE_RATE[] = {1.0f, 0.75f, 0.5f};
+constexpr float MIN_SPIN_US = 200.0f;
+constexpr float MAX_SPIN_US = 4000.0f;
+constexpr int ADAPTIVE_HOLD_FRAMES = 120; // Frames before the cap may step up again
+} // namespace
+
+FramePacer::FramePacer()
+  : mode(Mode::ADAPTIVE)
+  , targetFps(60.0f)
+  , currentCapFps(60.0f)
+  , adaptiveLevel(0)
+  , lastPresentUs(-1)
+  , oversleepUs(1000.0f)
+  , spinMarginUs(1500.0f)
+  , intervalsRecorded(0)
+  , lastWorkMs(0.0f)
+  , workEmaMs(0.0f)
+  , framesAtLevel(0) {}
+
+void FramePacer::setMode(Mode newMode, float newTargetFps) {
+  mode = newMode;
+  targetFps = std::max(1.0f, newTargetFps);
+  currentCapFps = targetFps;
+  adaptiveLevel = 0;
+  framesAtLevel = 0;
+  nextDeadline = sf::Time::Zero;
+
+#ifndef NDEBUG
+  std::cout << "FramePacer: mode " << static_cast<int>(mode) << ", target " << targetFps
+            << " FPS" << std::endl;
+#endif
+}
+
+void FramePacer::applyToWindow(sf::RenderWindow& window) const {
+  // Pacing is done here, never by SFML's coarse framerate limit
+  window.setFramerateLimit(0);
+  window.setVerticalSyncEnabled(mode == Mode::VSYNC);
+}
+
+sf::Time FramePacer::framePeriod() const {
+  return sf::seconds(1.0f / currentCapFps);
+}
+
+void FramePacer::beginFrame() {
+  frameStart = clock.getElapsedTime();
+}
+
+void FramePacer::waitUntil(sf::Time deadline) {
+  DP_PROFILE_ZONE("FramePacer::wait");
+  // Coarse sleep up to the spin margin; sf::sleep raises the OS timer
+  // resolution where needed, so this is the high-resolution sleep.
+  sf::Time now = clock.getElapsedTime();
+  const sf::Time sleepFor = deadline - now - sf::microseconds(static_cast<int>(spinMarginUs));
+  if (sleepFor > sf::Time::Zero) {
+    sf::sleep(sleepFor);
+    const sf::Time after = clock.getElapsedTime();
+    const float overshoot = static_cast<float>((after - now - sleepFor).asMicroseconds());
+    oversleepUs += (std::max(0.0f, overshoot) - oversleepUs) * 0.1f;
+    spinMarginUs = std::min(MAX_SPIN_US, std::max(MIN_SPIN_US, oversleepUs * 1.5f + 100.0f));
+  }
+
+  // Spin the tail for a precise wake-up
+  while (clock.getElapsedTime() < deadline) {
+  }
+}
+
+void FramePacer::endFrame() {
+  const sf::Time workEnd = clock.getElapsedTime();
+  const float workMs = (workEnd - frameStart).asSeconds() * 1000.0f;
+  lastWorkMs = workMs;
+
+  if (mode == Mode::FIXED_CAP || mode == Mode::ADAPTIVE) {
+    if (mode == Mode::ADAPTIVE) {
+      updateAdaptive(workMs);
+    }
+
+    const sf::Time period = framePeriod();
+    if (nextDeadline == sf::Time::Zero || workEnd > nextDeadline + period) {
+      // First frame, or more than a frame late: resynchronise instead of
+      // rushing to catch up with a burst of short frames
+      nextDeadline = workEnd + period;
+    } else {
+      nextDeadline += period;
+    }
+    waitUntil(nextDeadline);
+  }
+}
+
+void FramePacer::recordPresent() {
+  const std::int64_t now = clock.getElapsedTime().asMicroseconds();
+  const std::int64_t previous = lastPresentUs.exchange(now, std::memory_order_relaxed);
+  if (previous >= 0) {
+    recordInterval(static_cast<float>(now - previous) / 1000.0f);
+  }
+}
+
+void FramePacer::updateAdaptive(float workMs) {
+  workEmaMs = workEmaMs == 0.0f ? workMs : workEmaMs + (workMs - workEmaMs) * 0.05f;
+  ++framesAtLevel;
+
+  const float periodMs = 1000.0f / currentCapFps;
+  const int previousLevel = adaptiveLevel;
+  if (workEmaMs > periodMs * 0.9f && adaptiveLevel < ADAPTIVE_LEVELS - 1) {
+    // Missing deadlines: drop to the next steady rate
+    ++adaptiveLevel;
+  } else if (adaptiveLevel > 0 && framesAtLevel > ADAPTIVE_HOLD_FRAMES) {
+    const float fasterPeriodMs = 1000.0f / (targetFps * ADAPTIVE_RATE[adaptiveLevel - 1]);
+    if (workEmaMs < fasterPeriodMs * 0.6f) {
+      --adaptiveLevel;
+    }
+  }
+  if (adaptiveLevel == previousLevel) {
+    return;
+  }
+  framesAtLevel = 0;
+
+  currentCapFps = targetFps * ADAPTIVE_RATE[adaptiveLevel];
+#ifndef NDEBUG
+  std::cout << "FramePacer: adaptive cap now " << currentCapFps << " FPS (work "
+            << workEmaMs << " ms)" << std::endl;
+#endif
+}
+
+void FramePacer::recordInterval(float ms) {
+  const std::size_t index = intervalsRecorded.load(std::memory_order_relaxed);
+  intervals[index % HISTORY_SIZE].store(ms, std::memory_order_relaxed);
+  intervalsRecorded.store(index + 1, std::memory_order_release);
+}
+
+FramePacer::FrameStats FramePacer::getStats() const {
+  FrameStats stats;
+  const std::size_t intervalCount =
+      std::min(intervalsRecorded.load(std::memory_order_acquire), HISTORY_SIZE);
+  if (intervalCount == 0) {
+    return stats;
+  }
+
+  // A value overwritten while copying is just a newer interval
+  std::array<float, HISTORY_SIZE> sorted;
+  for (std::size_t i = 0; i < intervalCount; ++i) {
+    sorted[i] = intervals[i].load(std::memory_order_relaxed);
+  }
+  std::sort(sorted.begin(), sorted.begin() + intervalCount);
+
+  float sum = 0.0f;
+  for (std::size_t i = 0; i < intervalCount; ++i) {
+    sum += sorted[i];
+  }
+  auto percentile = [&](float p) {
+    std::size_t index = static_cast<std::size_t>(p * (intervalCount - 1) + 0.5f);
+    return sorted[std::min(index, intervalCount - 1)];
+  };
+
+  stats.averageMs = sum / intervalCount;
+  stats.p50Ms = percentile(0.50f);
+  stats.p95Ms = percentile(0.95f);
+  stats.p99Ms = percentile(0.99f);
+  stats.fps = stats.averageMs > 0.0f ? 1000.0f / stats.averageMs : 0.0f;
+  return stats;
+}
+
+} // namespace DP
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+
+namespace DP {
+
+/*!
+ * \brief FramePacer schedules frame presentation to a target rate
+ *
+ * Modes:
+ *  - UNLIMITED: present as fast as possible (benchmarking only)
+ *  - VSYNC: let the driver block in display()
+ *  - FIXED_CAP: sleep to an absolute deadline, then spin the last fraction of
+ *    a millisecond; the spin margin tracks measured oversleep so the sleep
+ *    gets as close as the OS timer allows without overshooting
+ *  - ADAPTIVE: like FIXED_CAP, but steps the cap down when frames cannot be
+ *    produced in time and back up when there is headroom, so frame times stay
+ *    even instead of alternating between fast and late frames
+ *
+ * Present intervals are recorded by whichever thread calls display() (the
+ * render thread while FramePresenter runs) into a lock-free ring buffer;
+ * percentiles feed the FPS overlay.
+ */
+class FramePacer {
+public:
+  enum class Mode { UNLIMITED, VSYNC, FIXED_CAP, ADAPTIVE };
+
+  struct FrameStats {
+    float averageMs = 0.0f;
+    float p50Ms = 0.0f;
+    float p95Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float fps = 0.0f;
+  };
+
+  FramePacer();
+
+  void setMode(Mode mode, float targetFps = 60.0f);
+  Mode getMode() const { return mode; }
+  float getTargetFps() const { return targetFps; }
+  float getCurrentCapFps() const { return currentCapFps; }
+
+  /*!
+   * \brief applyToWindow sets the window's vsync to match the mode
+   * Must be called again whenever the window is recreated.
+   */
+  void applyToWindow(sf::RenderWindow& window) const;
+
+  // Call at the start of the frame, before event handling and update
+  void beginFrame();
+
+  // Call at the end of the main loop iteration; waits for the next frame slot
+  void endFrame();
+
+  /*!
+   * \brief recordPresent stamps a present right after window.display()
+   * Safe to call from the render thread while the main thread reads getStats().
+   * Only one thread may present at a time.
+   */
+  void recordPresent();
+
+  FrameStats getStats() const;
+
+  // Work time of the last frame (beginFrame to endFrame, before waiting)
+  float getLastWorkMs() const { return lastWorkMs; }
+
+private:
+  static constexpr std::size_t HISTORY_SIZE = 240;
+  static constexpr int ADAPTIVE_LEVELS = 3;
+
+  Mode mode;
+  float targetFps;
+  float currentCapFps;
+  int adaptiveLevel; // 0 = full target rate
+
+  sf::Clock clock;
+  sf::Time frameStart;
+  sf::Time nextDeadline;
+  std::atomic<std::int64_t> lastPresentUs; // -1 until the first present
+
+  // Sleep calibration
+  float oversleepUs; // Smoothed oversleep of sf::sleep
+  float spinMarginUs;
+
+  // Present interval history (milliseconds); written by the presenting thread
+  std::array<std::atomic<float>, HISTORY_SIZE> intervals;
+  std::atomic<std::size_t> intervalsRecorded; // Total ever written, ring index is mod size
+
+  // Adaptive control
+  float lastWorkMs;
+  float workEmaMs; // Smoothed CPU+submit time before waiting
+  int framesAtLevel;
+
+  sf::Time framePeriod() const;
+  void waitUntil(sf::Time deadline);
+  void recordInterval(float ms);
+  void updateAdaptive(float workMs);
+};
+
+} // namespace DP
@@ -0,0 +1,234 @@
+#include "frame-presenter.h"
+
+#include <cstdint>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+#include <SFML/OpenGL.hpp>
+
+#include "profiler.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+namespace DP {
+
+namespace {
+
+// GL 3.2 / ARB_sync entry points; SFML does not expose them, and GLsync is an
+// opaque pointer
+using FenceSyncFunc = void*(APIENTRY*)(GLenum condition, GLbitfield flags);
+using WaitSyncFunc = void(APIENTRY*)(void* sync, GLbitfield flags, std::uint64_t timeout);
+using DeleteSyncFunc = void(APIENTRY*)(void* sync);
+
+const GLenum SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+const std::uint64_t TIMEOUT_IGNORED = 0xFFFFFFFFFFFFFFFFull;
+
+struct SyncFunctions {
+  FenceSyncFunc fenceSync = nullptr;
+  WaitSyncFunc waitSync = nullptr;
+  DeleteSyncFunc deleteSync = nullptr;
+};
+
+// Loaded with the first fence, while a context is active
+SyncFunctions& getSyncFunctions() {
+  static SyncFunctions functions = [] {
+    SyncFunctions loaded;
+    loaded.fenceSync = reinterpret_cast<FenceSyncFunc>(sf::Context::getFunction("glFenceSync"));
+    loaded.waitSync = reinterpret_cast<WaitSyncFunc>(sf::Context::getFunction("glWaitSync"));
+    loaded.deleteSync =
+        reinterpret_cast<DeleteSyncFunc>(sf::Context::getFunction("glDeleteSync"));
+    if (!loaded.fenceSync || !loaded.waitSync || !loaded.deleteSync) {
+      loaded = SyncFunctions();
+#ifndef NDEBUG
+      std::cout << "FramePresenter: no GL sync objects, finishing every frame" << std::endl;
+#endif
+    }
+    return loaded;
+  }();
+  return functions;
+}
+
+bool ensureSize(sf::RenderTexture& texture, sf::Vector2u size) {
+  if (texture.getSize() == size) {
+    return true;
+  }
+  return texture.resize(size);
+}
+} // namespace
+
+FramePresenter::FramePresenter()
+  : window(nullptr)
+  , pacer(nullptr)
+  , writeIndex(0)
+  , readyIndex(1)
+  , readIndex(2)
+  , fresh(false)
+  , published(0)
+  , picked(0)
+  , running(false)
+  , presentedFrames(0)
+  , failed(false) {}
+
+FramePresenter::~FramePresenter() {
+  stop();
+}
+
+bool FramePresenter::start(sf::RenderWindow& targetWindow, FramePacer& framePacer) {
+  if (thread.joinable() || hasFailed()) {
+    return isRunning();
+  }
+
+  window = &targetWindow;
+  pacer = &framePacer;
+  // A context can only be current on one thread at a time
+  if (!window->setActive(false)) {
+    std::cerr << "FramePresenter: cannot release the window context, presenting on main thread"
+              << std::endl;
+    failed.store(true, std::memory_order_release);
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    fresh = false;
+    published = 0;
+    picked = 0;
+  }
+  running.store(true, std::memory_order_release);
+  try {
+    thread = std::thread(&FramePresenter::run, this);
+  } catch (const std::system_error& e) {
+    std::cerr << "FramePresenter: cannot start render thread: " << e.what() << std::endl;
+    running.store(false, std::memory_order_release);
+    failed.store(true, std::memory_order_release);
+    return false;
+  }
+
+#ifndef NDEBUG
+  std::cout << "FramePresenter: render thread started" << std::endl;
+#endif
+  return true;
+}
+
+void FramePresenter::stop() {
+  if (!thread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    running.store(false, std::memory_order_release);
+  }
+  frameReady.notify_one();
+  framePicked.notify_all();
+  thread.join();
+
+#ifndef NDEBUG
+  std::cout << "FramePresenter: render thread stopped after " << getPresentedFrames()
+            << " frames" << std::endl;
+#endif
+}
+
+FramePresenter::Frame* FramePresenter::beginFrame(sf::Vector2u sceneSize,
+                                                  sf::Vector2u overlaySize) {
+  // writeIndex is only ever touched by the main thread outside publish()
+  Frame& frame = frames[writeIndex];
+  if (!ensureSize(frame.scene, sceneSize) || !ensureSize(frame.overlay, overlaySize)) {
+    std::cerr << "FramePresenter: failed to create frame textures" << std::endl;
+    return nullptr;
+  }
+  return &frame;
+}
+
+void FramePresenter::publish(bool waitForPickup) {
+  {
+    // The commands were issued in the render textures' context; the fence
+    // makes them visible to the window's context before it samples them
+    Frame& frame = frames[writeIndex];
+    (void)frame.scene.setActive(true);
+    const SyncFunctions& sync = getSyncFunctions();
+    if (sync.fenceSync) {
+      if (frame.fence) {
+        sync.deleteSync(frame.fence); // Frame was dropped before presenting
+      }
+      frame.fence = sync.fenceSync(SYNC_GPU_COMMANDS_COMPLETE, 0);
+      glFlush();
+    } else {
+      glFinish();
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  std::swap(writeIndex, readyIndex);
+  fresh = true;
+  const std::uint64_t frameNumber = ++published;
+  frameReady.notify_one();
+
+  if (waitForPickup) {
+    framePicked.wait(lock, [&] { return picked >= frameNumber || !isRunning(); });
+  }
+}
+
+void FramePresenter::run() {
+  DP_PROFILE_THREAD("Render thread");
+  if (!window->setActive(true)) {
+    std::cerr << "FramePresenter: render thread cannot activate the window context" << std::endl;
+    std::lock_guard<std::mutex> lock(mutex);
+    failed.store(true, std::memory_order_release);
+    running.store(false, std::memory_order_release);
+    framePicked.notify_all();
+    return;
+  }
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      frameReady.wait(lock, [&] { return fresh || !isRunning(); });
+      if (!isRunning()) break;
+
+      // Take the newest frame; an older one still waiting is simply dropped
+      std::swap(readIndex, readyIndex);
+      fresh = false;
+      picked = published;
+    }
+    framePicked.notify_all();
+
+    present(frames[readIndex]);
+    presentedFrames.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Hand the context back so the main thread can draw after stop()
+  (void)window->setActive(false);
+}
+
+void FramePresenter::present(Frame& frame) {
+  DP_PROFILE_ZONE("FramePresenter::present");
+  if (frame.fence) {
+    // Waits on the GPU, not here
+    const SyncFunctions& sync = getSyncFunctions();
+    sync.waitSync(frame.fence, 0, TIMEOUT_IGNORED);
+    sync.deleteSync(frame.fence);
+    frame.fence = nullptr;
+  }
+
+  // Overlay pixels were blended onto transparent black, so they are premultiplied
+  static const sf::BlendMode premultiplied(sf::BlendMode::Factor::One,
+                                           sf::BlendMode::Factor::OneMinusSrcAlpha);
+
+  sf::Sprite scene(frame.scene.getTexture());
+  scene.setScale(frame.sceneScale);
+  scene.setPosition(frame.scenePosition);
+
+  window->clear(sf::Color::Black); // Letterboxing
+  window->draw(scene);
+  if (frame.hasOverlay) {
+    window->draw(sf::Sprite(frame.overlay.getTexture()), premultiplied);
+  }
+  window->display();
+  pacer->recordPresent();
+}
+
+} // namespace DP
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <SFML/Graphics.hpp>
+
+#include "frame-pacer.h"
+#include "scene-render-texture.h"
+
+namespace DP {
+
+/*!
+ * \brief FramePresenter shows finished frames from a dedicated render thread
+ *
+ * The main thread renders the scene into its own texture, swaps it into the
+ * write slot of a triple buffer (no copy), adds the overlay and publishes it. The render thread owns the window's GL
+ * context, always takes the newest published frame, upscales it into the
+ * window and presents it. Presentation, including the vsync wait, overlaps
+ * with the next update on the main thread, and a slow update never leaves the
+ * render thread without a complete frame. Every present is stamped on the
+ * FramePacer right after display(), so its statistics are real present
+ * intervals rather than main loop ticks.
+ *
+ * While the presenter runs, the main thread must not draw to, display or
+ * recreate the window; stop() first.
+ */
+class FramePresenter {
+public:
+  /*!
+   * \brief Frame is an immutable snapshot once published
+   */
+  struct Frame {
+    SceneRenderTexture scene;  // Scene at render resolution, swapped with Game's
+    sf::RenderTexture overlay; // Text overlays at window resolution, premultiplied
+    bool hasOverlay = false;   // overlay is stale and skipped when false
+    sf::Vector2f sceneScale{1.0f, 1.0f};
+    sf::Vector2f scenePosition;
+    void* fence = nullptr; // GL sync object the render thread waits on
+  };
+
+  FramePresenter();
+  ~FramePresenter();
+
+  /*!
+   * \brief start hands the window's context over to a new render thread
+   * \param framePacer Receives the present timestamps
+   * \return false if the thread could not be started; the caller keeps
+   * presenting on its own thread
+   */
+  bool start(sf::RenderWindow& window, FramePacer& framePacer);
+
+  // Waits for the frame being presented, then returns the context to the caller
+  void stop();
+
+  bool isRunning() const { return running.load(std::memory_order_acquire); }
+  bool hasFailed() const { return failed.load(std::memory_order_acquire); }
+
+  /*!
+   * \brief beginFrame returns the slot the main thread may fill
+   * \param sceneSize Size of the scene render texture
+   * \param overlaySize Size of the window
+   * \return nullptr if the slot textures could not be created
+   */
+  Frame* beginFrame(sf::Vector2u sceneSize, sf::Vector2u overlaySize);
+
+  /*!
+   * \brief publish makes the filled slot the newest frame
+   * Fences the slot's GL commands first, since the render thread samples the
+   * textures from another context.
+   * \param waitForPickup Block until the render thread has taken it; used with
+   * vsync so the main loop runs at the display rate instead of dropping frames
+   */
+  void publish(bool waitForPickup);
+
+  std::uint64_t getPresentedFrames() const {
+    return presentedFrames.load(std::memory_order_relaxed);
+  }
+
+private:
+  sf::RenderWindow* window;
+  FramePacer* pacer;
+  std::array<Frame, 3> frames;
+
+  // Slot indices, always a permutation of 0, 1, 2
+  int writeIndex;
+  int readyIndex;
+  int readIndex;
+  bool fresh; // readyIndex holds a frame not yet taken
+
+  std::mutex mutex;
+  std::condition_variable frameReady;
+  std::condition_variable framePicked;
+  std::uint64_t published;
+  std::uint64_t picked;
+
+  std::thread thread;
+  std::atomic<bool> running;
+  std::atomic<std::uint64_t> presentedFrames;
+  std::atomic<bool> failed;
+
+  void run();
+  void present(Frame& frame);
+};
+
+} // namespace DP
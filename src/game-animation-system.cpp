@@ -9,38 +9,33 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+#include "draw-stats.h"
 #include "game.h"
+#include "profiler.h"
 
 namespace DP {
 
-// Static lookup tables for web-inspired performance optimization
-std::array<float, GameAnimationSystem::TRIG_TABLE_SIZE> GameAnimationSystem::s_sinTable;
-std::array<float, GameAnimationSystem::TRIG_TABLE_SIZE> GameAnimationSystem::s_cosTable;
-bool GameAnimationSystem::s_trigTablesInitialized = false;
-std::array<uint8_t, GameAnimationSystem::FADE_TABLE_SIZE> GameAnimationSystem::s_fadeTable;
-
 GameAnimationSystem::GameAnimationSystem(Game* gameInstance)
     : game(gameInstance), oscillator(-1.0f), oscillatorInc(true), oscillatorSpeed(1.0f),
       bigDiamondAnimationActive(false), bigDiamondBasePosition(474.0f, 342.0f),
-      m_particleTexture(nullptr), m_particlesDirty(false), m_lastVertexRebuild(sf::Time::Zero) {
+      m_particleTexture(nullptr) {
   initializeAnimationStates();
 
-  // Initialize VertexArray for batched particle rendering
-  m_particleVertices.setPrimitiveType(sf::PrimitiveType::Triangles);
-
   // Initialize advanced optimization systems
   initializeParticlePool();
-
-  // Web Performance Patterns: Initialize lookup tables
-  if (!s_trigTablesInitialized) {
-    initializeTrigTables();
-  }
-  initializeFadeTable();
 }
 
 GameAnimationSystem::~GameAnimationSystem() {}
 
+void GameAnimationSystem::recordFrameWorkTime(float seconds) {
+  // Tracks frame-time pressure for the particle budget
+  if (seconds > 0.0f && seconds < 0.25f) { // Ignore stalls such as window drags
+    m_smoothedFrameTime += (seconds - m_smoothedFrameTime) * 0.1f;
+  }
+}
+
 void GameAnimationSystem::update(sf::Time frameTime) {
+  DP_PROFILE_ZONE("GameAnimationSystem::update");
   // Update oscillator for various animations
   updateOscillator(frameTime);
 
@@ -57,13 +52,10 @@ void GameAnimationSystem::update(sf::Time frameTime) {
 
   // Update circle particles
   updateCircleParticles(frameTime);
+  updateGpuBursts(frameTime.asSeconds());
 }
 
-void GameAnimationSystem::addEffect(AnimationEffect effect) {
-  m_effects.push_back(effect);
-}
-
-// Diamond collection effect - multi-stage animation as per Gemini plan
+// Diamond collection effect - pop, then fly to the HUD while shrinking and fading
 void GameAnimationSystem::createDiamondCollectionEffect(sf::Sprite* diamondSprite,
                                                         sf::Vector2f playerHudPos) {
   if (!diamondSprite) return;
@@ -71,41 +63,14 @@ void GameAnimationSystem::createDiamondCollectionEffect(sf::Sprite* diamondSprit
   sf::Vector2f startPos = diamondSprite->getPosition();
 
   // Stage 1: "Pop" effect - scale up with bounce
-  AnimationEffect pop;
-  pop.target = diamondSprite;
-  pop.lifetime = sf::seconds(0.2f);
-  pop.scale.startScale = {1.0f, 1.0f};
-  pop.scale.endScale = {1.3f, 1.3f};
-  pop.scale.ease = Easing::easeOutQuad;
-
-  // Stage 2: Fly to HUD with scale down and fade
-  pop.onComplete = [this, diamondSprite, startPos, playerHudPos]() {
-    AnimationEffect fly;
-    fly.target = diamondSprite;
-    fly.lifetime = sf::seconds(0.8f);
-
-    // Move to player HUD
-    fly.move.startPos = startPos;
-    fly.move.endPos = playerHudPos;
-    fly.move.ease = Easing::easeInOutCubic;
-
-    // Scale down as it flies
-    fly.scale.startScale = {1.3f, 1.3f};
-    fly.scale.endScale = {0.5f, 0.5f};
-    fly.scale.ease = Easing::easeInCubic;
-
-    // Fade out as it approaches HUD
-    fly.fade.startAlpha = 255.0f;
-    fly.fade.endAlpha = 0.0f;
-    fly.fade.ease = Easing::easeInQuad;
-
-    // Stage 3: Complete - hide sprite
-    fly.onComplete = [diamondSprite]() { diamondSprite->setColor(sf::Color::Transparent); };
-
-    addEffect(fly);
-  };
-
-  addEffect(pop);
+  TweenHandle pop = m_tweens.create(0.2f);
+  m_tweens.addScale(pop, diamondSprite, {1.0f, 1.0f}, {1.3f, 1.3f}, Ease::OutQuad);
+
+  // Stage 2: Fly to HUD with scale down and fade out, leaving the sprite hidden
+  TweenHandle fly = m_tweens.chain(pop, 0.8f);
+  m_tweens.addMove(fly, diamondSprite, startPos, playerHudPos, Ease::InOutCubic);
+  m_tweens.addScale(fly, diamondSprite, {1.3f, 1.3f}, {0.5f, 0.5f}, Ease::InCubic);
+  m_tweens.addFade(fly, diamondSprite, 255.0f, 0.0f, Ease::InQuad);
 }
 
 // Overloaded method for board position (works with vertex array system)
@@ -124,67 +89,49 @@ void GameAnimationSystem::createDiamondCollectionEffect(int boardPosition,
   float offsetY = (DP::TILE_SIZE - 44.0f) / 2.0f;
   tempSprite->setPosition({tilePos.x + offsetX, tilePos.y + offsetY});
 
-  // Store the sprite for the animation duration
-  m_temporarySprites.push_back(std::move(tempSprite));
-  sf::Sprite* spritePtr = m_temporarySprites.back().get();
+  sf::Sprite* spritePtr = tempSprite.get();
+  sf::Vector2f startPos = spritePtr->getPosition();
 
   // Stage 1: "Pop" effect
-  AnimationEffect pop;
-  pop.target = spritePtr;
-  pop.lifetime = sf::seconds(0.2f);
-  pop.scale.startScale = {1.0f, 1.0f};
-  pop.scale.endScale = {1.3f, 1.3f};
-  pop.scale.ease = Easing::easeOutQuad;
-
-  sf::Vector2f startPos = spritePtr->getPosition();
+  TweenHandle pop = m_tweens.create(0.2f);
+  m_tweens.addScale(pop, spritePtr, {1.0f, 1.0f}, {1.3f, 1.3f}, Ease::OutQuad);
 
   // Stage 2: Fly to HUD
-  pop.onComplete = [this, spritePtr, startPos, playerHudPos]() {
-    AnimationEffect fly;
-    fly.target = spritePtr;
-    fly.lifetime = sf::seconds(0.8f);
-
-    fly.move.startPos = startPos;
-    fly.move.endPos = playerHudPos;
-    fly.move.ease = Easing::easeInOutCubic;
-
-    fly.scale.startScale = {1.3f, 1.3f};
-    fly.scale.endScale = {0.5f, 0.5f};
-    fly.scale.ease = Easing::easeInCubic;
-
-    fly.fade.startAlpha = 255.0f;
-    fly.fade.endAlpha = 0.0f;
-    fly.fade.ease = Easing::easeInQuad;
-
-    // Clean up temporary sprite when done
-    fly.onComplete = [this, spritePtr]() {
-      // Remove from temporary sprites vector
-      m_temporarySprites.erase(
-          std::remove_if(m_temporarySprites.begin(), m_temporarySprites.end(),
-                         [spritePtr](const std::unique_ptr<sf::Sprite>& sprite) {
-                           return sprite.get() == spritePtr;
-                         }),
-          m_temporarySprites.end());
-    };
-
-    addEffect(fly);
-  };
-
-  addEffect(pop);
+  TweenHandle fly = m_tweens.chain(pop, 0.8f);
+  m_tweens.addMove(fly, spritePtr, startPos, playerHudPos, Ease::InOutCubic);
+  m_tweens.addScale(fly, spritePtr, {1.3f, 1.3f}, {0.5f, 0.5f}, Ease::InCubic);
+  m_tweens.addFade(fly, spritePtr, 255.0f, 0.0f, Ease::InQuad);
+
+  // Keep the sprite alive until the fly stage completes
+  m_temporarySprites.push_back({fly, std::move(tempSprite)});
 }
 
 // Rendering support for temporary sprites
 void GameAnimationSystem::drawTemporarySprites(sf::RenderTarget& target) const {
-  for (const auto& sprite : m_temporarySprites) {
-    target.draw(*sprite);
+  for (const auto& temporary : m_temporarySprites) {
+    target.draw(*temporary.sprite);
+    DP::DrawStats::count();
   }
 }
 
 // Generic particle burst system - supports different particle types
 void GameAnimationSystem::createCollectionBurst(sf::Vector2f position,
                                                 const ParticleConfig& config) {
-  const int particleCount = config.count;
-  const float speed = config.speed;
+  const int particleCount = budgetedParticleCount(config.count, config.priority);
+
+  ++m_budgetStats.bursts;
+  if (particleCount < config.count) {
+    ++m_budgetStats.throttledBursts;
+    m_budgetStats.droppedParticles += static_cast<unsigned int>(config.count - particleCount);
+#ifndef NDEBUG
+    std::cout << "DEBUG: Particle budget throttled burst " << config.count << " -> "
+              << particleCount << " (live: " << m_particlePool.count << "/" << m_particleBudget
+              << ")" << std::endl;
+#endif
+  }
+  if (particleCount <= 0) {
+    return;
+  }
 
 #ifndef NDEBUG
   std::cout << "DEBUG: Creating " << config.textureId
@@ -197,182 +144,427 @@ void GameAnimationSystem::createCollectionBurst(sf::Vector2f position,
   sf::Texture* textureToUse =
       config.customTexture ? config.customTexture : &game->textures.textureBoardDiamond;
 
-  // Create particle sprite if not exists
-  if (!m_particleSprite) {
-    m_particleSprite = std::make_unique<sf::Sprite>(*textureToUse);
-    m_particleSprite->setTextureRect(config.textureRect);
-    m_particleSprite->setScale({config.scale, config.scale});
-#ifndef NDEBUG
-    std::cout << "DEBUG: Created particle sprite with scale: " << config.scale
-              << " using texture: " << config.textureId << std::endl;
-#endif
-  }
-
   // Set texture reference for VertexArray batching
   m_particleTexture = textureToUse;
 
+  // Stateless GPU path: upload spawn parameters once, the shader does the rest
+  if (m_gpuParticlesEnabled && ensureBurstShader()) {
+    createGpuBurst(position, config, particleCount, textureToUse);
+    return;
+  }
+
   // Create particles based on burst pattern
+  ParticlePool& pool = m_particlePool;
+  const float halfSize = config.textureRect.size.x * config.scale * 0.5f;
+#ifndef NDEBUG
+  int created = 0;
+#endif
   for (int i = 0; i < particleCount; ++i) {
-    CircleParticle particle;
-
-    // Start position (center)
-    particle.position = position;
-
-    // Set particle properties from config
-    particle.scale = config.scale;
-    particle.textureRect = config.textureRect;
-    particle.fadeOut = config.fadeOut;
-    particle.gravity = config.gravity;
-
-    // Calculate velocity based on pattern
-    if (config.pattern == ParticleConfig::BurstPattern::CIRCLE) {
-      // Even distribution in circle
-      float angle = (i * 2.0f * M_PI) / particleCount;
-      particle.velocity = sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed);
-    } else if (config.pattern == ParticleConfig::BurstPattern::EXPLOSION) {
-      // Random explosion pattern
-      float angle = (static_cast<float>(rand()) / RAND_MAX) * 2.0f * M_PI;
-      float speedVariation = 0.5f + (static_cast<float>(rand()) / RAND_MAX) * 0.5f;
-      particle.velocity = sf::Vector2f(std::cos(angle) * speed * speedVariation,
-                                       std::sin(angle) * speed * speedVariation);
-    } else if (config.pattern == ParticleConfig::BurstPattern::DIRECTIONAL) {
-      // Directional pattern (upward with spread) - 4x wider distribution
-      float angle = -M_PI / 2 + (i - particleCount / 2) * (M_PI / 1.5) /
-                                    particleCount; // 4x wider: PI/6 -> PI/1.5
-      particle.velocity = sf::Vector2f(std::cos(angle) * speed * 1.2f,
-                                       std::sin(angle) * speed); // Enhanced horizontal spread
-    }
-
-    // Lifetime from config
-    particle.lifetime = sf::seconds(config.lifetime);
-    particle.totalLifetime = sf::seconds(config.lifetime);
-    particle.active = true;
-
-    m_circleParticles.push_back(particle);
+    const size_t index = acquireParticle();
+    if (index == SIZE_MAX) break; // Pool exhausted - drop the rest of the burst
+
+    const sf::Vector2f velocity = burstVelocity(config, i, particleCount);
+
+    // Start position (center) and properties from config
+    pool.posX[index] = position.x;
+    pool.posY[index] = position.y;
+    pool.velX[index] = velocity.x;
+    pool.velY[index] = velocity.y;
+    pool.gravity[index] = config.gravity;
+    pool.life[index] = config.lifetime;
+    pool.invLifetime[index] = config.lifetime > 0.0f ? 1.0f / config.lifetime : 0.0f;
+    pool.halfSize[index] = halfSize;
+    pool.texLeft[index] = static_cast<float>(config.textureRect.position.x);
+    pool.texTop[index] = static_cast<float>(config.textureRect.position.y);
+    pool.texRight[index] = static_cast<float>(config.textureRect.position.x + config.textureRect.size.x);
+    pool.texBottom[index] = static_cast<float>(config.textureRect.position.y + config.textureRect.size.y);
+    pool.fadeOut[index] = config.fadeOut ? 1 : 0;
+#ifndef NDEBUG
+    ++created;
+#endif
   }
 
 #ifndef NDEBUG
-  std::cout << "DEBUG: Created " << particleCount
-            << " particles. Total particles: " << m_circleParticles.size() << std::endl;
+  std::cout << "DEBUG: Created " << created
+            << " particles. Total particles: " << pool.count << std::endl;
 #endif
 }
 
-// Legacy method for backward compatibility
-void GameAnimationSystem::createDiamondCollectionBurst(sf::Vector2f position) {
-  createCollectionBurst(position, ParticlePresets::DIAMOND_BURST);
+/*!
+ * \brief budgetedParticleCount scales a burst to fit the live particle budget
+ *
+ * Two pressures shrink a burst: the budget filling up past 75%, and the
+ * smoothed frame time exceeding the target. Low priority bursts feel both
+ * fully, high priority ones only partially, so the important feedback keeps
+ * its density while decorative bursts thin out first. The result never
+ * exceeds the remaining budget.
+ */
+int GameAnimationSystem::budgetedParticleCount(int requested,
+                                               ParticleConfig::Priority priority) const {
+  if (requested <= 0) return 0;
+
+  const size_t live = m_particlePool.count + m_gpuParticleCount;
+  if (live >= m_particleBudget) return 0;
+  const float remaining = static_cast<float>(m_particleBudget - live);
+
+  float sensitivity = 0.6f;
+  if (priority == ParticleConfig::Priority::LOW) {
+    sensitivity = 1.0f;
+  } else if (priority == ParticleConfig::Priority::HIGH) {
+    sensitivity = 0.25f;
+  }
+
+  // Occupancy pressure ramps from 0 at 75% full to 1 at the budget
+  const float fill = static_cast<float>(live) / static_cast<float>(m_particleBudget);
+  const float occupancyPressure = std::max(0.0f, (fill - 0.75f) / 0.25f);
+
+  // Frame pressure ramps from 0 at the target to 1 at twice the target
+  float framePressure = 0.0f;
+  if (m_targetFrameTime > 0.0f) {
+    framePressure = std::min(1.0f, std::max(0.0f, (m_smoothedFrameTime - m_targetFrameTime) /
+                                                      m_targetFrameTime));
+  }
+
+  const float pressure = std::max(occupancyPressure, framePressure);
+  const float scale = std::max(0.1f, 1.0f - pressure * sensitivity);
+
+  float budgeted = std::ceil(static_cast<float>(requested) * scale);
+  budgeted = std::min(budgeted, remaining);
+  return static_cast<int>(budgeted);
 }
 
-// Draw circle particles using VertexArray batching for performance
-void GameAnimationSystem::drawCircleParticles(sf::RenderTarget& target) const {
-#ifndef NDEBUG
-  // Debug output every time when particles exist
-  if (!m_circleParticles.empty()) {
-    std::cout << "DEBUG: drawCircleParticles called with " << m_circleParticles.size()
-              << " particles (VertexArray mode)" << std::endl;
+void GameAnimationSystem::setParticleBudget(size_t maxLiveParticles) {
+  m_particleBudget = std::min(std::max<size_t>(maxLiveParticles, 1), PARTICLE_POOL_SIZE);
+}
+
+// Initial velocity of particle i out of count for the config's burst pattern
+sf::Vector2f GameAnimationSystem::burstVelocity(const ParticleConfig& config, int i, int count) {
+  const float speed = config.speed;
+
+  if (config.pattern == ParticleConfig::BurstPattern::EXPLOSION) {
+    // Random explosion pattern
+    float angle = (static_cast<float>(rand()) / RAND_MAX) * 2.0f * M_PI;
+    float speedVariation = 0.5f + (static_cast<float>(rand()) / RAND_MAX) * 0.5f;
+    return sf::Vector2f(std::cos(angle) * speed * speedVariation,
+                        std::sin(angle) * speed * speedVariation);
+  }
+  if (config.pattern == ParticleConfig::BurstPattern::DIRECTIONAL) {
+    // Directional pattern (upward with spread) - 4x wider distribution
+    float angle = -M_PI / 2 + (i - count / 2) * (M_PI / 1.5) / count; // 4x wider: PI/6 -> PI/1.5
+    return sf::Vector2f(std::cos(angle) * speed * 1.2f,
+                        std::sin(angle) * speed); // Enhanced horizontal spread
   }
-#endif
 
-  // Use VertexArray for batched rendering (6 draw calls -> 1 draw call)
-  if (m_particleVertices.getVertexCount() > 0 && m_particleTexture) {
-#ifndef NDEBUG
-    size_t triangleCount = m_particleVertices.getVertexCount() / 6;
-    std::cout << "DEBUG: Drawing " << triangleCount
-              << " particles with single VertexArray draw call" << std::endl;
-#endif
+  // Even distribution in circle
+  float angle = (i * 2.0f * M_PI) / count;
+  return sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed);
+}
 
-    // SINGLE draw call for all particles
-    target.draw(m_particleVertices, m_particleTexture);
-    return;
+// ================================================================================
+// GPU BURSTS: closed-form particle motion evaluated in a vertex shader
+// ================================================================================
+
+namespace {
+// Legacy GLSL with fixed-function built-ins, which Mesa's software rasterizers
+// (llvmpipe/softpipe) and every desktop driver SFML targets accept.
+const std::string burstVertexShader = R"(
+#version 120
+
+uniform vec2 origin;
+uniform float time;
+uniform float lifetime;
+uniform float gravity;
+uniform float halfSize;
+uniform float fadeOut;
+uniform float scaleDown;
+
+// gl_Vertex.xy carries the initial velocity, gl_Color.rg the quad corner
+void main() {
+  float t = min(time, lifetime);
+  float ratio = lifetime > 0.0 ? clamp(t / lifetime, 0.0, 1.0) : 1.0;
+
+  vec2 center = origin + gl_Vertex.xy * t + vec2(0.0, 0.5 * gravity * t * t);
+  vec2 corner = gl_Color.rg * 2.0 - 1.0;
+  float size = halfSize * (scaleDown > 0.5 ? 1.0 - ratio : 1.0);
+
+  gl_Position = gl_ModelViewProjectionMatrix * vec4(center + corner * size, 0.0, 1.0);
+  gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+  gl_FrontColor = vec4(1.0, 1.0, 1.0, fadeOut > 0.5 ? 1.0 - ratio : 1.0);
+}
+)";
+
+const std::string burstFragmentShader = R"(
+#version 120
+
+uniform sampler2D texture;
+
+void main() {
+  gl_FragColor = gl_Color * texture2D(texture, gl_TexCoord[0].xy);
+}
+)";
+} // namespace
+
+bool GameAnimationSystem::ensureBurstShader() {
+  if (m_burstShaderState == BurstShaderState::Untried) {
+    m_burstShaderState = BurstShaderState::Unavailable;
+    if (!sf::Shader::isAvailable()) {
+      std::cerr << "Particle bursts: shaders unavailable, simulating on the CPU" << std::endl;
+    } else if (!m_burstShader.loadFromMemory(burstVertexShader, burstFragmentShader)) {
+      std::cerr << "Particle bursts: failed to compile burst shader, simulating on the CPU"
+                << std::endl;
+    } else {
+      m_burstShader.setUniform("texture", sf::Shader::CurrentTexture);
+      m_burstShaderState = BurstShaderState::Ready;
+    }
   }
+  return m_burstShaderState == BurstShaderState::Ready;
+}
 
-  // Fallback to old method if VertexArray not available
-  if (!m_particleSprite) {
-#ifndef NDEBUG
-    if (!m_circleParticles.empty()) {
-      std::cout << "DEBUG: ERROR - No particle sprite or VertexArray available!" << std::endl;
+void GameAnimationSystem::setGpuParticles(bool enabled) {
+  m_gpuParticlesEnabled = enabled;
+}
+
+void GameAnimationSystem::createGpuBurst(sf::Vector2f position, const ParticleConfig& config,
+                                         int particleCount, const sf::Texture* texture) {
+  auto burst = std::make_unique<GpuBurst>();
+  burst->origin = position;
+  burst->lifetime = config.lifetime;
+  burst->gravity = config.gravity;
+  burst->halfSize = config.textureRect.size.x * config.scale * 0.5f;
+  burst->fadeOut = config.fadeOut;
+  burst->scaleDown = config.scaleDown;
+  burst->texture = texture;
+  burst->particleCount = static_cast<size_t>(particleCount);
+
+  const float left = static_cast<float>(config.textureRect.position.x);
+  const float top = static_cast<float>(config.textureRect.position.y);
+  const float right = left + config.textureRect.size.x;
+  const float bottom = top + config.textureRect.size.y;
+  const sf::Color topLeft(0, 0, 0), topRight(255, 0, 0), bottomLeft(0, 255, 0),
+      bottomRight(255, 255, 0);
+
+  float maxSpeed = 0.0f;
+  burst->vertices.resize(static_cast<size_t>(particleCount) * 6);
+  sf::Vertex* vertex = burst->vertices.data();
+  for (int i = 0; i < particleCount; ++i) {
+    const sf::Vector2f velocity = burstVelocity(config, i, particleCount);
+    maxSpeed = std::max(maxSpeed, std::hypot(velocity.x, velocity.y));
+
+    vertex[0] = sf::Vertex{velocity, topLeft, {left, top}};
+    vertex[1] = sf::Vertex{velocity, topRight, {right, top}};
+    vertex[2] = sf::Vertex{velocity, bottomLeft, {left, bottom}};
+    vertex[3] = vertex[1];
+    vertex[4] = sf::Vertex{velocity, bottomRight, {right, bottom}};
+    vertex[5] = vertex[2];
+    vertex += 6;
+  }
+
+  // Conservative culling radius covering the whole flight
+  burst->reach = maxSpeed * config.lifetime +
+                 0.5f * std::abs(config.gravity) * config.lifetime * config.lifetime +
+                 burst->halfSize;
+
+  // Upload once; keep the client-side copy only when buffers are unsupported
+  if (sf::VertexBuffer::isAvailable()) {
+    auto buffer = std::make_unique<sf::VertexBuffer>(sf::PrimitiveType::Triangles,
+                                                     sf::VertexBuffer::Usage::Static);
+    if (buffer->create(burst->vertices.size()) && buffer->update(burst->vertices.data())) {
+      burst->buffer = std::move(buffer);
+      burst->vertices.clear();
+      burst->vertices.shrink_to_fit();
     }
-#endif
-    return;
   }
 
+  m_gpuParticleCount += burst->particleCount;
+  m_gpuBursts.push_back(std::move(burst));
+
 #ifndef NDEBUG
-  std::cout << "DEBUG: Fallback to individual sprite drawing" << std::endl;
+  std::cout << "DEBUG: Created GPU burst of " << particleCount
+            << " particles. GPU bursts live: " << m_gpuBursts.size() << std::endl;
 #endif
+}
+
+void GameAnimationSystem::updateGpuBursts(float deltaSeconds) {
+  // One age per burst is the only per-frame CPU state
+  for (size_t i = m_gpuBursts.size(); i-- > 0;) {
+    GpuBurst& burst = *m_gpuBursts[i];
+    burst.age += deltaSeconds;
+    if (burst.age >= burst.lifetime) {
+      m_gpuParticleCount -= burst.particleCount;
+      m_gpuBursts[i] = std::move(m_gpuBursts.back());
+      m_gpuBursts.pop_back();
+    }
+  }
+}
+
+void GameAnimationSystem::drawGpuBursts(sf::RenderTarget& target) {
+  if (m_gpuBursts.empty()) return;
 
-  int activeCount = 0;
-  for (const auto& particle : m_circleParticles) {
-    if (particle.active) {
-      activeCount++;
-      // Update sprite position
-      m_particleSprite->setPosition(particle.position);
+  if (m_cullingGrid) {
+    m_cullingGrid->setView(target.getView());
+  }
+
+  sf::RenderStates states;
+  states.shader = &m_burstShader;
+  for (const auto& burstPtr : m_gpuBursts) {
+    const GpuBurst& burst = *burstPtr;
+    if (m_cullingGrid && !m_cullingGrid->isVisible(burst.origin, burst.reach)) {
+      continue;
+    }
 
-      // Draw the particle (individual draw call)
-      target.draw(*m_particleSprite);
+    m_burstShader.setUniform("origin", burst.origin);
+    m_burstShader.setUniform("time", burst.age);
+    m_burstShader.setUniform("lifetime", burst.lifetime);
+    m_burstShader.setUniform("gravity", burst.gravity);
+    m_burstShader.setUniform("halfSize", burst.halfSize);
+    m_burstShader.setUniform("fadeOut", burst.fadeOut ? 1.0f : 0.0f);
+    m_burstShader.setUniform("scaleDown", burst.scaleDown ? 1.0f : 0.0f);
+    states.texture = burst.texture;
+
+    if (burst.buffer) {
+      target.draw(*burst.buffer, states);
+      DP::DrawStats::count();
+    } else {
+      target.draw(burst.vertices.data(), burst.vertices.size(), sf::PrimitiveType::Triangles,
+                  states);
+      DP::DrawStats::count();
     }
   }
+}
+
+// Legacy method for backward compatibility
+void GameAnimationSystem::createDiamondCollectionBurst(sf::Vector2f position) {
+  createCollectionBurst(position, ParticlePresets::DIAMOND_BURST);
+}
+
+// Cull particles against the target's view, then draw the survivors in one call
+void GameAnimationSystem::drawCircleParticles(sf::RenderTarget& target) {
+  drawGpuBursts(target);
+
+  if (m_particlePool.count == 0 || !m_particleTexture) {
+    m_particleVertexCount = 0;
+    return;
+  }
 
-#ifndef NDEBUG
-  if (activeCount > 0) {
-    std::cout << "DEBUG: Drew " << activeCount << " particles using individual draw calls"
-              << std::endl;
+  if (m_cullingGrid) {
+    m_cullingGrid->setView(target.getView());
   }
-#endif
+  writeParticleVertices();
+  if (m_particleVertexCount == 0) {
+    return;
+  }
+
+  sf::RenderStates states;
+  states.texture = m_particleTexture;
+  target.draw(m_particleVertices.data(), m_particleVertexCount, sf::PrimitiveType::Triangles,
+              states);
+  DP::DrawStats::count();
 }
 
-// Update circle particles position and lifetime
+// Integrate all live particles, swap-remove expired ones and write their vertices
 void GameAnimationSystem::updateCircleParticles(sf::Time frameTime) {
-  // Update all particles
-  int activeCount = 0;
-  for (auto& particle : m_circleParticles) {
-    if (particle.active) {
-      activeCount++;
-
-      // Apply gravity if configured
-      if (particle.gravity > 0.0f) {
-        particle.velocity.y += particle.gravity * frameTime.asSeconds();
-      }
+  ParticlePool& pool = m_particlePool;
+  const size_t count = pool.count;
+  if (count == 0) {
+    return;
+  }
 
-      // Update position
-      particle.position += particle.velocity * frameTime.asSeconds();
+  const float dt = frameTime.asSeconds();
+  float* const posX = pool.posX.data();
+  float* const posY = pool.posY.data();
+  float* const velX = pool.velX.data();
+  float* const velY = pool.velY.data();
+  float* const life = pool.life.data();
+  const float* const gravity = pool.gravity.data();
 
-      // Update lifetime
-      particle.lifetime -= frameTime;
+  // Branch-free loops over contiguous arrays so they vectorize
+  for (size_t i = 0; i < count; ++i) {
+    velY[i] += gravity[i] * dt;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    posX[i] += velX[i] * dt;
+    posY[i] += velY[i] * dt;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    life[i] -= dt;
+  }
 
-      // Deactivate if expired
-      if (particle.lifetime <= sf::Time::Zero) {
-        particle.active = false;
-      }
+  // Walk backwards so every swapped-in particle has already been checked
+  for (size_t i = count; i-- > 0;) {
+    if (life[i] <= 0.0f) {
+      releaseParticle(i);
     }
   }
 
-#ifndef NDEBUG
-  if (activeCount > 0) {
-    std::cout << "DEBUG: Updating " << activeCount << " active particles" << std::endl;
-  }
-#endif
+  logPerformanceMetrics();
+}
 
-  // Clean up inactive particles
-  size_t beforeSize = m_circleParticles.size();
-  m_circleParticles.erase(std::remove_if(m_circleParticles.begin(), m_circleParticles.end(),
-                                         [](const CircleParticle& p) { return !p.active; }),
-                          m_circleParticles.end());
+void GameAnimationSystem::writeParticleVertices() {
+  const ParticlePool& pool = m_particlePool;
+  const size_t count = pool.count;
+  const SpatialGrid* grid = m_cullingGrid;
+  sf::Vertex* vertex = m_particleVertices.data();
 
-#ifndef NDEBUG
-  if (beforeSize != m_circleParticles.size()) {
-    std::cout << "DEBUG: Cleaned up particles, before: " << beforeSize
-              << ", after: " << m_circleParticles.size() << std::endl;
+  if (!grid) {
+    for (size_t i = 0; i < count; ++i) {
+      vertex = writeParticleQuad(i, vertex);
+    }
+    m_particleVertexCount = static_cast<size_t>(vertex - m_particleVertices.data());
+    return;
   }
-#endif
 
-  // Rebuild VertexArray for batched rendering
-  m_particleVertices.clear();
-  if (m_particleTexture) {
-    for (const auto& particle : m_circleParticles) {
-      if (particle.active) {
-        addParticleToVertexArray(particle);
+  // Bin by the cell of each centre; particles that left the world get no cell
+  m_particleCells.resize(count);
+  float maxHalfSize = 0.0f;
+  for (size_t i = 0; i < count; ++i) {
+    m_particleCells[i] = grid->getCellIndex(sf::Vector2f(pool.posX[i], pool.posY[i]),
+                                            pool.halfSize[i]);
+    maxHalfSize = std::max(maxHalfSize, pool.halfSize[i]);
+  }
+  m_particleBins.build(m_particleCells, grid->getCellCount());
+
+  // Only the visible cells produce vertices
+  sf::Vector2i first;
+  sf::Vector2i last;
+  if (grid->getVisibleCells(maxHalfSize, first, last)) {
+    for (int row = first.y; row <= last.y; ++row) {
+      for (int column = first.x; column <= last.x; ++column) {
+        const int cell = row * grid->getColumns() + column;
+        for (const uint32_t* it = m_particleBins.begin(cell); it != m_particleBins.end(cell);
+             ++it) {
+          vertex = writeParticleQuad(*it, vertex);
+        }
       }
     }
   }
+
+  m_particleVertexCount = static_cast<size_t>(vertex - m_particleVertices.data());
+}
+
+sf::Vertex* GameAnimationSystem::writeParticleQuad(size_t i, sf::Vertex* vertex) const {
+  const ParticlePool& pool = m_particlePool;
+
+  // Fade out as lifetime decreases
+  float alpha = 255.0f;
+  if (pool.fadeOut[i]) {
+    alpha = std::max(0.0f, std::min(255.0f, 255.0f * pool.life[i] * pool.invLifetime[i]));
+  }
+  const sf::Color color(255, 255, 255, static_cast<uint8_t>(alpha));
+
+  const float h = pool.halfSize[i];
+  const float left = pool.posX[i] - h;
+  const float right = pool.posX[i] + h;
+  const float top = pool.posY[i] - h;
+  const float bottom = pool.posY[i] + h;
+
+  // Two triangles per particle: (TL, TR, BL) and (TR, BR, BL)
+  vertex[0] = sf::Vertex{{left, top}, color, {pool.texLeft[i], pool.texTop[i]}};
+  vertex[1] = sf::Vertex{{right, top}, color, {pool.texRight[i], pool.texTop[i]}};
+  vertex[2] = sf::Vertex{{left, bottom}, color, {pool.texLeft[i], pool.texBottom[i]}};
+  vertex[3] = vertex[1];
+  vertex[4] = sf::Vertex{{right, bottom}, color, {pool.texRight[i], pool.texBottom[i]}};
+  vertex[5] = vertex[2];
+  return vertex + 6;
 }
 
 // Oscillator management (extracted from game.cpp)
@@ -474,60 +666,19 @@ void GameAnimationSystem::createVisualEffect(sf::Vector2f position, const std::s
 }
 
 void GameAnimationSystem::updateVisualEffects(sf::Time frameTime) {
-  for (auto& effect : m_effects) {
-    if (!effect.active) continue;
-
-    effect.elapsed += frameTime;
-    float t = effect.elapsed.asSeconds() / effect.lifetime.asSeconds();
-    if (t > 1.0f) t = 1.0f;
-
-    if (effect.target) {
-      // Move
-      if (effect.move.endPos != effect.move.startPos) {
-        sf::Vector2f newPos = effect.move.startPos +
-                              (effect.move.endPos - effect.move.startPos) * effect.move.ease(t);
-        effect.target->setPosition(newPos);
-      }
+  m_tweens.update(frameTime.asSeconds());
 
-      // Scale
-      if (effect.scale.endScale != effect.scale.startScale) {
-        sf::Vector2f newScale =
-            effect.scale.startScale +
-            (effect.scale.endScale - effect.scale.startScale) * effect.scale.ease(t);
-        effect.target->setScale(newScale);
-      }
-
-      // Fade
-      if (effect.fade.endAlpha != effect.fade.startAlpha) {
-        float newAlpha = effect.fade.startAlpha +
-                         (effect.fade.endAlpha - effect.fade.startAlpha) * effect.fade.ease(t);
-        if (auto* shape = dynamic_cast<sf::Shape*>(effect.target)) {
-          sf::Color color = shape->getFillColor();
-          color.a = static_cast<uint8_t>(newAlpha);
-          shape->setFillColor(color);
-        } else if (auto* sprite = dynamic_cast<sf::Sprite*>(effect.target)) {
-          sf::Color color = sprite->getColor();
-          color.a = static_cast<uint8_t>(newAlpha);
-          sprite->setColor(color);
-        } else if (auto* text = dynamic_cast<sf::Text*>(effect.target)) {
-          sf::Color color = text->getFillColor();
-          color.a = static_cast<uint8_t>(newAlpha);
-          text->setFillColor(color);
-        }
-      }
-    }
-
-    if (effect.elapsed >= effect.lifetime) {
-      effect.active = false;
-      if (effect.onComplete) {
-        effect.onComplete();
-      }
-    }
-  }
+  // Drop temporary sprites whose tween chain finished this frame
+  const std::vector<TweenHandle>& completed = m_tweens.getCompleted();
+  if (completed.empty() || m_temporarySprites.empty()) return;
 
-  m_effects.erase(std::remove_if(m_effects.begin(), m_effects.end(),
-                                 [](const AnimationEffect& effect) { return !effect.active; }),
-                  m_effects.end());
+  m_temporarySprites.erase(
+      std::remove_if(m_temporarySprites.begin(), m_temporarySprites.end(),
+                     [&completed](const TemporarySprite& temporary) {
+                       return std::find(completed.begin(), completed.end(),
+                                        temporary.releaseWith) != completed.end();
+                     }),
+      m_temporarySprites.end());
 }
 
 // Animation queries
@@ -550,7 +701,7 @@ bool GameAnimationSystem::hasActiveAnimations() const {
     if (charAnim.isAnimating) return true;
   }
 
-  if (!m_effects.empty()) return true;
+  if (m_tweens.getActiveCount() > 0) return true;
 
   return false;
 }
@@ -600,97 +751,35 @@ float GameAnimationSystem::calculateOscillatorModifier() const {
   return sin(oscillator / 2.5f) * 30.0f;
 }
 
-void GameAnimationSystem::addParticleToVertexArray(const CircleParticle& particle) {
-  if (!m_particleTexture) return;
-
-  // Calculate particle sprite size using particle's texture rect and scale
-  const float particleSize = particle.textureRect.size.x * particle.scale;
-  const float halfSize = particleSize * 0.5f;
-
-  // Particle position (center-based)
-  sf::Vector2f pos = particle.position;
-
-  // Calculate alpha based on lifetime for fade effect
-  float alpha = 255.0f;
-  if (particle.fadeOut && particle.totalLifetime > sf::Time::Zero) {
-    float lifeRatio = particle.lifetime.asSeconds() / particle.totalLifetime.asSeconds();
-    alpha = 255.0f * lifeRatio; // Fade out as lifetime decreases
-  }
-
-  // Use particle's texture coordinates
-  sf::IntRect textureRect = particle.textureRect;
-
-  // Create two triangles for this particle (since we use PrimitiveType::Triangles)
-  sf::Vertex vertices[6];
-
-  // First triangle (top-left, top-right, bottom-left)
-  vertices[0].position = sf::Vector2f(pos.x - halfSize, pos.y - halfSize);
-  vertices[0].texCoords = sf::Vector2f(textureRect.position.x, textureRect.position.y);
-  vertices[0].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[1].position = sf::Vector2f(pos.x + halfSize, pos.y - halfSize);
-  vertices[1].texCoords =
-      sf::Vector2f(textureRect.position.x + textureRect.size.x, textureRect.position.y);
-  vertices[1].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[2].position = sf::Vector2f(pos.x - halfSize, pos.y + halfSize);
-  vertices[2].texCoords =
-      sf::Vector2f(textureRect.position.x, textureRect.position.y + textureRect.size.y);
-  vertices[2].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  // Second triangle (top-right, bottom-right, bottom-left)
-  vertices[3].position = sf::Vector2f(pos.x + halfSize, pos.y - halfSize);
-  vertices[3].texCoords =
-      sf::Vector2f(textureRect.position.x + textureRect.size.x, textureRect.position.y);
-  vertices[3].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[4].position = sf::Vector2f(pos.x + halfSize, pos.y + halfSize);
-  vertices[4].texCoords = sf::Vector2f(textureRect.position.x + textureRect.size.x,
-                                       textureRect.position.y + textureRect.size.y);
-  vertices[4].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[5].position = sf::Vector2f(pos.x - halfSize, pos.y + halfSize);
-  vertices[5].texCoords =
-      sf::Vector2f(textureRect.position.x, textureRect.position.y + textureRect.size.y);
-  vertices[5].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  // Add vertices to the VertexArray
-  for (int i = 0; i < 6; ++i) {
-    m_particleVertices.append(vertices[i]);
-  }
-}
-
 // ================================================================================
 // ADVANCED OPTIMIZATION PATTERNS (Web/SFML 3.0.1/OpenGL Inspired)
 // ================================================================================
 
-void GameAnimationSystem::initializeParticlePool() {
-  // Object Pooling Pattern: Pre-allocate all particles for O(1) allocation
-  for (size_t i = 0; i < PARTICLE_POOL_SIZE; ++i) {
-    m_particlePool[i].active = false;
-    m_availableParticleIndices.push(i);
+void GameAnimationSystem::ParticlePool::allocate(size_t capacity) {
+  for (auto* array : {&posX, &posY, &velX, &velY, &gravity, &life, &invLifetime, &halfSize,
+                      &texLeft, &texTop, &texRight, &texBottom}) {
+    array->assign(capacity, 0.0f);
   }
-  m_activeParticleIndices.reserve(PARTICLE_POOL_SIZE / 4); // Reasonable active estimate
-
-  // Initialize double-buffered VertexArrays
-  m_particleVertices.setPrimitiveType(sf::PrimitiveType::Triangles);
-  m_particleVerticesBack.setPrimitiveType(sf::PrimitiveType::Triangles);
+  fadeOut.assign(capacity, 0);
+  count = 0;
+}
 
-  // Pre-allocate VertexArray capacity (200 particles × 6 vertices = 1200 vertices max per burst)
+void GameAnimationSystem::initializeParticlePool() {
+  // Object Pooling Pattern: Pre-allocate every particle and vertex up front
+  m_particlePool.allocate(PARTICLE_POOL_SIZE);
   m_particleVertices.resize(PARTICLE_POOL_SIZE * 6);
-  m_particleVerticesBack.resize(PARTICLE_POOL_SIZE * 6);
-
-  initializeSpatialGrid();
+  m_particleCells.reserve(PARTICLE_POOL_SIZE);
+  m_particleVertexCount = 0;
 
 #ifndef NDEBUG
   std::cout << "DEBUG: Particle system initialized with " << PARTICLE_POOL_SIZE
-            << " pooled particles and advanced optimizations" << std::endl;
+            << " pooled particles (structure of arrays)" << std::endl;
 #endif
 }
 
 size_t GameAnimationSystem::acquireParticle() {
-  // Web Browser Memory Management Pattern: O(1) allocation from free list
-  if (m_availableParticleIndices.empty()) {
+  // O(1) allocation: the free region is everything past the packed live range
+  if (m_particlePool.count >= PARTICLE_POOL_SIZE) {
 #ifndef NDEBUG
     std::cout << "WARNING: Particle pool exhausted! Consider increasing PARTICLE_POOL_SIZE"
               << std::endl;
@@ -698,190 +787,29 @@ size_t GameAnimationSystem::acquireParticle() {
     return SIZE_MAX; // Pool exhausted
   }
 
-  size_t index = m_availableParticleIndices.front();
-  m_availableParticleIndices.pop();
-  m_activeParticleIndices.push_back(index);
-
-  // Reset particle to clean state
-  m_particlePool[index] = CircleParticle{}; // Zero-initialize
-  m_particlePool[index].active = true;
-
-  markParticlesDirty(); // RequestAnimationFrame-style dirty marking
-  return index;
+  return m_particlePool.count++;
 }
 
 void GameAnimationSystem::releaseParticle(size_t index) {
-  // O(1) deallocation back to pool
-  if (index >= PARTICLE_POOL_SIZE) return;
-
-  m_particlePool[index].active = false;
-  m_availableParticleIndices.push(index);
-
-  // Remove from active list (O(n) but small list)
-  auto it = std::find(m_activeParticleIndices.begin(), m_activeParticleIndices.end(), index);
-  if (it != m_activeParticleIndices.end()) {
-    m_activeParticleIndices.erase(it);
-  }
-
-  markParticlesDirty();
-}
-
-bool GameAnimationSystem::shouldRebuildVertices(sf::Time currentTime) const {
-  // RequestAnimationFrame-style throttling: prevent excessive rebuilds
-  if (!m_particlesDirty) return false;
-
-  float timeSinceLastRebuild = (currentTime - m_lastVertexRebuild).asSeconds();
-  return timeSinceLastRebuild >= VERTEX_REBUILD_THROTTLE;
-}
-
-void GameAnimationSystem::throttledVertexRebuild(sf::Time currentTime) {
-  // Web Browser Dirty Rectangle Pattern: Only rebuild when needed and throttled
-  if (!shouldRebuildVertices(currentTime)) return;
-
-  // Double-buffered VertexArray swap (OpenGL front/back buffer pattern)
-  m_particleVerticesBack.clear();
-
-  // Efficiently rebuild only active particles with web-optimized precalculation
-  for (size_t index : m_activeParticleIndices) {
-    const auto& particle = m_particlePool[index];
-    if (particle.active) {
-      addParticleToVertexArrayPrecalc(particle, index); // Use precalculated version
-    }
-  }
-
-  // Atomic swap: minimal frame disruption
-  std::swap(m_particleVertices, m_particleVerticesBack);
-
-  m_particlesDirty = false;
-  m_lastVertexRebuild = currentTime;
-
-#ifndef NDEBUG
-  static int rebuildCount = 0;
-  if (++rebuildCount % 60 == 0) { // Log every 60 rebuilds
-    std::cout << "DEBUG: VertexArray rebuilt " << rebuildCount
-              << " times, active particles: " << m_activeParticleIndices.size() << std::endl;
-  }
-#endif
-}
-
-void GameAnimationSystem::initializeSpatialGrid() {
-  // Game Engine Spatial Partitioning: 8×8 grid for culling
-  const float cellWidth = 1920.0f / SPATIAL_GRID_SIZE; // Assume 1920x1080 viewport
-  const float cellHeight = 1080.0f / SPATIAL_GRID_SIZE;
-
-  for (int x = 0; x < SPATIAL_GRID_SIZE; ++x) {
-    for (int y = 0; y < SPATIAL_GRID_SIZE; ++y) {
-      // SFML 3.0.1 syntax: sf::FloatRect(position, size)
-      m_spatialGrid[x][y].bounds = sf::FloatRect(sf::Vector2f(x * cellWidth, y * cellHeight),
-                                                 sf::Vector2f(cellWidth, cellHeight));
-      m_spatialGrid[x][y].particleIndices.reserve(32); // Reasonable estimate
-    }
-  }
-}
-
-void GameAnimationSystem::updateSpatialPartitioning() {
-  // Clear all cells
-  for (auto& row : m_spatialGrid) {
-    for (auto& cell : row) {
-      cell.particleIndices.clear();
-    }
-  }
-
-  // Distribute active particles into spatial cells
-  for (size_t index : m_activeParticleIndices) {
-    const auto& particle = m_particlePool[index];
-    if (particle.active) {
-      auto [x, y] = getGridCell(particle.position);
-      if (x >= 0 && x < SPATIAL_GRID_SIZE && y >= 0 && y < SPATIAL_GRID_SIZE) {
-        m_spatialGrid[x][y].particleIndices.push_back(index);
-      }
-    }
-  }
-}
-
-std::pair<int, int> GameAnimationSystem::getGridCell(const sf::Vector2f& position) const {
-  // Convert world position to grid coordinates
-  const float cellWidth = 1920.0f / SPATIAL_GRID_SIZE;
-  const float cellHeight = 1080.0f / SPATIAL_GRID_SIZE;
-
-  int x = static_cast<int>(position.x / cellWidth);
-  int y = static_cast<int>(position.y / cellHeight);
-
-  return {x, y};
-}
-
-void GameAnimationSystem::cullInvisibleParticles(const sf::FloatRect& viewBounds) {
-  // OpenGL Frustum Culling Pattern: Mark spatial cells as visible/invisible
-  m_viewBounds = viewBounds;
-
-  for (auto& row : m_spatialGrid) {
-    for (auto& cell : row) {
-      // SFML 3.0.1: Custom intersection check (intersects method removed)
-      cell.visible = (viewBounds.position.x < cell.bounds.position.x + cell.bounds.size.x &&
-                      viewBounds.position.x + viewBounds.size.x > cell.bounds.position.x &&
-                      viewBounds.position.y < cell.bounds.position.y + cell.bounds.size.y &&
-                      viewBounds.position.y + viewBounds.size.y > cell.bounds.position.y);
-    }
-  }
-}
-
-void GameAnimationSystem::addParticleToVertexArrayOptimized(const CircleParticle& particle,
-                                                            size_t index) {
-  // GPU-friendly optimized vertex generation with spatial culling
-  auto [gridX, gridY] = getGridCell(particle.position);
-
-  // Spatial culling: skip particles outside view
-  if (gridX >= 0 && gridX < SPATIAL_GRID_SIZE && gridY >= 0 && gridY < SPATIAL_GRID_SIZE) {
-    if (!m_spatialGrid[gridX][gridY].visible) {
-      return; // Particle culled
-    }
-  }
-
-  // Use original addParticleToVertexArray logic but with back buffer
-  const sf::Vector2f& pos = particle.position;
-  float halfSize = 22.0f * particle.scale; // Base size 44px / 2
-
-  // Calculate alpha for fade effect
-  float alpha = 255.0f;
-  if (particle.fadeOut && particle.totalLifetime > sf::Time::Zero) {
-    float lifeRatio = particle.lifetime.asSeconds() / particle.totalLifetime.asSeconds();
-    alpha *= lifeRatio;
-  }
-  alpha = std::max(0.0f, std::min(255.0f, alpha));
-
-  const sf::IntRect& textureRect = particle.textureRect;
-
-  // Create 6 vertices for 2 triangles (quad) - optimized for cache locality
-  sf::Vertex vertices[6];
-
-  // First triangle (top-left, top-right, bottom-left)
-  vertices[0].position = sf::Vector2f(pos.x - halfSize, pos.y - halfSize);
-  vertices[0].texCoords = sf::Vector2f(textureRect.position.x, textureRect.position.y);
-  vertices[0].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[1].position = sf::Vector2f(pos.x + halfSize, pos.y - halfSize);
-  vertices[1].texCoords =
-      sf::Vector2f(textureRect.position.x + textureRect.size.x, textureRect.position.y);
-  vertices[1].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[2].position = sf::Vector2f(pos.x - halfSize, pos.y + halfSize);
-  vertices[2].texCoords =
-      sf::Vector2f(textureRect.position.x, textureRect.position.y + textureRect.size.y);
-  vertices[2].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  // Second triangle (top-right, bottom-right, bottom-left)
-  vertices[3] = vertices[1]; // Reuse top-right
-
-  vertices[4].position = sf::Vector2f(pos.x + halfSize, pos.y + halfSize);
-  vertices[4].texCoords = sf::Vector2f(textureRect.position.x + textureRect.size.x,
-                                       textureRect.position.y + textureRect.size.y);
-  vertices[4].color = sf::Color(255, 255, 255, static_cast<uint8_t>(alpha));
-
-  vertices[5] = vertices[2]; // Reuse bottom-left
-
-  // Add to back buffer VertexArray
-  for (int i = 0; i < 6; ++i) {
-    m_particleVerticesBack.append(vertices[i]);
+  // O(1) swap-remove: move the last live particle into the freed slot
+  ParticlePool& pool = m_particlePool;
+  if (index >= pool.count) return;
+
+  const size_t last = --pool.count;
+  if (index != last) {
+    pool.posX[index] = pool.posX[last];
+    pool.posY[index] = pool.posY[last];
+    pool.velX[index] = pool.velX[last];
+    pool.velY[index] = pool.velY[last];
+    pool.gravity[index] = pool.gravity[last];
+    pool.life[index] = pool.life[last];
+    pool.invLifetime[index] = pool.invLifetime[last];
+    pool.halfSize[index] = pool.halfSize[last];
+    pool.texLeft[index] = pool.texLeft[last];
+    pool.texTop[index] = pool.texTop[last];
+    pool.texRight[index] = pool.texRight[last];
+    pool.texBottom[index] = pool.texBottom[last];
+    pool.fadeOut[index] = pool.fadeOut[last];
   }
 }
 
@@ -890,7 +818,7 @@ void GameAnimationSystem::logPerformanceMetrics() const {
 #ifndef NDEBUG
   static int logCount = 0;
   if (++logCount % 600 == 0) { // Log every 10 seconds
-    size_t activeParticles = m_activeParticleIndices.size();
+    size_t activeParticles = m_particlePool.count;
     size_t poolUtilization = (100 * activeParticles) / PARTICLE_POOL_SIZE;
 
     if (activeParticles > 0) {
@@ -901,186 +829,4 @@ void GameAnimationSystem::logPerformanceMetrics() const {
 #endif
 }
 
-// ================================================================================
-// WEB PERFORMANCE PATTERNS: Precalculation & Memoization
-// ================================================================================
-
-void GameAnimationSystem::initializeTrigTables() {
-  // Canvas/WebGL pattern: Precalculate trigonometry for O(1) lookup
-  for (size_t i = 0; i < TRIG_TABLE_SIZE; ++i) {
-    float radians = (static_cast<float>(i) * 2.0f * M_PI) / TRIG_TABLE_SIZE;
-    s_sinTable[i] = std::sin(radians);
-    s_cosTable[i] = std::cos(radians);
-  }
-  s_trigTablesInitialized = true;
-
-#ifndef NDEBUG
-  std::cout << "DEBUG: Trigonometry lookup tables initialized (" << TRIG_TABLE_SIZE << " entries)"
-            << std::endl;
-#endif
-}
-
-float GameAnimationSystem::fastSin(int degrees) {
-  // O(1) trigonometry lookup with bounds checking
-  int index = ((degrees % 360) + 360) % 360; // Handle negative degrees
-  return s_sinTable[index];
-}
-
-float GameAnimationSystem::fastCos(int degrees) {
-  // O(1) trigonometry lookup with bounds checking
-  int index = ((degrees % 360) + 360) % 360; // Handle negative degrees
-  return s_cosTable[index];
-}
-
-void GameAnimationSystem::initializeFadeTable() {
-  // Smooth alpha transition lookup table (similar to CSS transitions)
-  for (size_t i = 0; i < FADE_TABLE_SIZE; ++i) {
-    float ratio = static_cast<float>(i) / (FADE_TABLE_SIZE - 1);
-    // Smooth fade curve (could use easing functions)
-    s_fadeTable[i] = static_cast<uint8_t>(255.0f * ratio);
-  }
-}
-
-uint8_t GameAnimationSystem::getFadeAlpha(float ratio) const {
-  // O(1) alpha calculation using lookup table
-  if (ratio <= 0.0f) return 0;
-  if (ratio >= 1.0f) return 255;
-
-  size_t index = static_cast<size_t>(ratio * (FADE_TABLE_SIZE - 1));
-  return s_fadeTable[index];
-}
-
-std::pair<int, int> GameAnimationSystem::getGridCellFast(const sf::Vector2f& position) const {
-  // Fast division using bit shifting (web optimization pattern)
-  // Only works if cell size is power of 2 (256 pixels = 2^8)
-  int x = static_cast<int>(position.x) >> CELL_SHIFT_BITS; // Fast divide by 256
-  int y = static_cast<int>(position.y) >> CELL_SHIFT_BITS; // Fast divide by 256
-  return {x, y};
-}
-
-uint32_t GameAnimationSystem::hashScale(float scale) const {
-  // Simple hash function for memoization (JavaScript-style)
-  union {
-    float f;
-    uint32_t i;
-  } converter;
-  converter.f = scale;
-  return converter.i;
-}
-
-uint64_t GameAnimationSystem::hashTypeScale(const sf::IntRect& rect, float scale) const {
-  // Combined hash for vertex template caching
-  uint32_t rectHash =
-      static_cast<uint32_t>(rect.position.x) ^ (static_cast<uint32_t>(rect.position.y) << 8) ^
-      (static_cast<uint32_t>(rect.size.x) << 16) ^ (static_cast<uint32_t>(rect.size.y) << 24);
-  uint32_t scaleHash = hashScale(scale);
-  return (static_cast<uint64_t>(rectHash) << 32) | scaleHash;
-}
-
-const GameAnimationSystem::VertexOffsets& GameAnimationSystem::getVertexOffsets(float scale) {
-  // Memoization pattern: Cache expensive vertex offset calculations
-  uint32_t key = hashScale(scale);
-
-  auto it = m_vertexOffsetCache.find(key);
-  if (it != m_vertexOffsetCache.end()) {
-    return it->second; // Cache hit - O(1) return
-  }
-
-  // Cache miss - calculate and store
-  float halfSize = 22.0f * scale; // Base size 44px / 2
-  VertexOffsets offsets;
-  offsets.topLeft = sf::Vector2f(-halfSize, -halfSize);
-  offsets.topRight = sf::Vector2f(halfSize, -halfSize);
-  offsets.bottomLeft = sf::Vector2f(-halfSize, halfSize);
-  offsets.bottomRight = sf::Vector2f(halfSize, halfSize);
-
-  m_vertexOffsetCache[key] = offsets;
-  return m_vertexOffsetCache[key];
-}
-
-const GameAnimationSystem::VertexTemplate&
-GameAnimationSystem::getVertexTemplate(uint64_t typeScaleHash) {
-  // Canvas-style vertex template caching (typed array pattern)
-  auto it = m_vertexTemplateCache.find(typeScaleHash);
-  if (it != m_vertexTemplateCache.end() && it->second.initialized) {
-    return it->second; // Template cache hit
-  }
-
-  // This is a placeholder - would be populated when creating particle templates
-  // For now, return a default template
-  static VertexTemplate defaultTemplate;
-  if (!defaultTemplate.initialized) {
-    // Initialize default template with unit positions
-    defaultTemplate.positions[0] = sf::Vector2f(-1.0f, -1.0f); // Top-left
-    defaultTemplate.positions[1] = sf::Vector2f(1.0f, -1.0f);  // Top-right
-    defaultTemplate.positions[2] = sf::Vector2f(-1.0f, 1.0f);  // Bottom-left
-    defaultTemplate.positions[3] = sf::Vector2f(1.0f, -1.0f);  // Top-right (repeat)
-    defaultTemplate.positions[4] = sf::Vector2f(1.0f, 1.0f);   // Bottom-right
-    defaultTemplate.positions[5] = sf::Vector2f(-1.0f, 1.0f);  // Bottom-left (repeat)
-    defaultTemplate.initialized = true;
-  }
-
-  return defaultTemplate;
-}
-
-void GameAnimationSystem::addParticleToVertexArrayPrecalc(const CircleParticle& particle,
-                                                          size_t index) {
-  // Web-optimized vertex generation using precalculated offsets and memoization
-
-  // Fast spatial culling with bit shifting
-  auto [gridX, gridY] = getGridCellFast(particle.position);
-  if (gridX >= 0 && gridX < SPATIAL_GRID_SIZE && gridY >= 0 && gridY < SPATIAL_GRID_SIZE) {
-    if (!m_spatialGrid[gridX][gridY].visible) {
-      return; // Particle culled - no expensive calculations needed
-    }
-  }
-
-  // Use memoized vertex offsets (Canvas optimization pattern)
-  const VertexOffsets& offsets = getVertexOffsets(particle.scale);
-
-  // Fast alpha calculation using lookup table
-  uint8_t alpha = 255;
-  if (particle.fadeOut && particle.totalLifetime > sf::Time::Zero) {
-    float lifeRatio = particle.lifetime.asSeconds() / particle.totalLifetime.asSeconds();
-    alpha = getFadeAlpha(lifeRatio);
-  }
-
-  const sf::Vector2f& pos = particle.position;
-  const sf::IntRect& textureRect = particle.textureRect;
-  sf::Color color(255, 255, 255, alpha);
-
-  // Optimized vertex creation using precalculated offsets
-  sf::Vertex vertices[6];
-
-  // First triangle (top-left, top-right, bottom-left)
-  vertices[0].position = pos + offsets.topLeft;
-  vertices[0].texCoords = sf::Vector2f(textureRect.position.x, textureRect.position.y);
-  vertices[0].color = color;
-
-  vertices[1].position = pos + offsets.topRight;
-  vertices[1].texCoords =
-      sf::Vector2f(textureRect.position.x + textureRect.size.x, textureRect.position.y);
-  vertices[1].color = color;
-
-  vertices[2].position = pos + offsets.bottomLeft;
-  vertices[2].texCoords =
-      sf::Vector2f(textureRect.position.x, textureRect.position.y + textureRect.size.y);
-  vertices[2].color = color;
-
-  // Second triangle (reuse vertices for cache efficiency)
-  vertices[3] = vertices[1]; // Top-right
-
-  vertices[4].position = pos + offsets.bottomRight;
-  vertices[4].texCoords = sf::Vector2f(textureRect.position.x + textureRect.size.x,
-                                       textureRect.position.y + textureRect.size.y);
-  vertices[4].color = color;
-
-  vertices[5] = vertices[2]; // Bottom-left
-
-  // Add to back buffer VertexArray
-  for (int i = 0; i < 6; ++i) {
-    m_particleVerticesBack.append(vertices[i]);
-  }
-}
-
 } // namespace DP
\ No newline at end of file
@@ -5,14 +5,13 @@
 #include <array>
 #include <functional>
 #include <memory>
-#include <queue>
-#include <unordered_map>
 #include <vector>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
-#include "easing.h"
+#include "spatial-grid.h"
+#include "tween-engine.h"
 
 namespace DP {
 
@@ -48,54 +47,26 @@ public:
     // Pattern configuration
     enum class BurstPattern { CIRCLE, EXPLOSION, DIRECTIONAL };
     BurstPattern pattern = BurstPattern::CIRCLE;
-  };
-  struct AnimationEffect {
-    // Core properties
-    sf::Time lifetime = sf::seconds(1.0f);
-    sf::Time elapsed = sf::Time::Zero;
-    bool active = true;
-
-    // Target (what is being animated)
-    sf::Transformable* target = nullptr; // e.g., a sprite or text
-
-    // Modules for different kinds of animation
-    struct Move {
-      sf::Vector2f startPos;
-      sf::Vector2f endPos;
-      std::function<float(float)> ease = Easing::linear;
-    } move;
-
-    struct Scale {
-      sf::Vector2f startScale;
-      sf::Vector2f endScale;
-      std::function<float(float)> ease = Easing::linear;
-    } scale;
-
-    struct Fade {
-      float startAlpha = 255.f;
-      float endAlpha = 0.f;
-      std::function<float(float)> ease = Easing::linear;
-    } fade;
-
-    // Particle burst on completion
-    struct ParticleBurst {
-      int count = 0;
-      std::string textureId; // From GameAssets
-      sf::Time particleLifetime = sf::seconds(1.0f);
-    } particleBurst;
-
-    // Chaining: what to trigger when this effect finishes
-    std::function<void()> onComplete;
+
+    // Budget priority: lower priorities are scaled down first under pressure
+    enum class Priority { LOW, NORMAL, HIGH };
+    Priority priority = Priority::NORMAL;
   };
 
+  // Particle budget counters, for tuning presets against the budget
+  struct ParticleBudgetStats {
+    unsigned int bursts = 0;           // Bursts requested
+    unsigned int throttledBursts = 0;  // Bursts emitted with fewer particles than requested
+    unsigned int droppedParticles = 0; // Particles not emitted because of the budget
+  };
   GameAnimationSystem(Game* gameInstance);
   ~GameAnimationSystem();
 
   // Main update method
   void update(sf::Time frameTime);
 
-  // A new, generic way to add effects
-  void addEffect(AnimationEffect effect);
+  // Tween engine driving sprite move/scale/fade effects
+  TweenEngine& getTweens() { return m_tweens; }
 
   // Convenience methods for common effects
   void createDiamondCollectionEffect(sf::Sprite* diamondSprite, sf::Vector2f playerHudPos);
@@ -138,98 +109,107 @@ public:
 
   // Rendering support
   void drawTemporarySprites(sf::RenderTarget& target) const;
-  void drawCircleParticles(sf::RenderTarget& target) const;
+  void drawCircleParticles(sf::RenderTarget& target);
+  size_t getActiveParticleCount() const { return m_particlePool.count; }
+  size_t getVisibleParticleCount() const { return m_particleVertexCount / 6; }
+
+  // GPU bursts: spawn parameters are uploaded once and a vertex shader
+  // evaluates position, fade and scale from the burst age. Falls back to the
+  // CPU pool when shaders are unavailable.
+  void setGpuParticles(bool enabled);
+  bool isUsingGpuParticles() const {
+    return m_gpuParticlesEnabled && m_burstShaderState != BurstShaderState::Unavailable;
+  }
+  size_t getGpuParticleCount() const { return m_gpuParticleCount; }
+
+  // Compiles the burst shader once; called from the loading screen so the
+  // first burst in gameplay does not pay for it
+  bool ensureBurstShader();
+  sf::Shader& getBurstShader() { return m_burstShader; }
+
+  // Broad-phase culling against the active view (shared with lights and the board animator)
+  void setCullingGrid(SpatialGrid* grid) { m_cullingGrid = grid; }
+
+  // Particle budget: caps live particles and scales bursts under frame-time pressure
+  void setParticleBudget(size_t maxLiveParticles);
+  size_t getParticleBudget() const { return m_particleBudget; }
+  void setTargetFrameTime(float seconds) { m_targetFrameTime = seconds; }
+  // Work time of the last frame without the pacer's sleep; 0 is ignored
+  void recordFrameWorkTime(float seconds);
+  const ParticleBudgetStats& getParticleBudgetStats() const { return m_budgetStats; }
+  void resetParticleBudgetStats() { m_budgetStats = ParticleBudgetStats(); }
 
 private:
   Game* game; // Reference to main game instance
 
-  std::vector<AnimationEffect> m_effects;
-  std::vector<std::unique_ptr<sf::Sprite>> m_temporarySprites; // For diamond collection animations
+  TweenEngine m_tweens;
 
-  // Simple circle burst particles (your preferred approach)
-  struct CircleParticle {
-    sf::Vector2f position;
-    sf::Vector2f velocity;
-    sf::Time lifetime;
-    sf::Time totalLifetime;
-    bool active = true;
-
-    // Enhanced properties for generic system
-    float scale = 0.5f;
-    sf::IntRect textureRect = sf::IntRect(sf::Vector2i(4 * 44, 0), sf::Vector2i(44, 44));
-    bool fadeOut = true;
-    float gravity = 0.0f;
+  // Sprites owned for the duration of a tween chain (diamond collection animations)
+  struct TemporarySprite {
+    TweenHandle releaseWith; // Sprite is destroyed when this tween completes
+    std::unique_ptr<sf::Sprite> sprite;
   };
-  std::vector<CircleParticle> m_circleParticles;
-  std::unique_ptr<sf::Sprite> m_particleSprite; // Reused for all particles
-
-  // Advanced Optimization Patterns (Web/SFML 3.0.1/OpenGL inspired)
-
-  // 1. Object Pooling Pattern (inspired by web browser memory management)
-  static constexpr size_t PARTICLE_POOL_SIZE = 2048; // Increased pool for 10x particle counts
-  std::array<CircleParticle, PARTICLE_POOL_SIZE> m_particlePool;
-  std::queue<size_t> m_availableParticleIndices; // Free list for O(1) allocation
-  std::vector<size_t> m_activeParticleIndices;   // Active particles for iteration
-
-  // Web Performance Patterns: Precalculation & Memoization
-
-  // Trigonometry Lookup Tables (Canvas/WebGL pattern)
-  static constexpr size_t TRIG_TABLE_SIZE = 360; // 1-degree precision
-  static std::array<float, TRIG_TABLE_SIZE> s_sinTable;
-  static std::array<float, TRIG_TABLE_SIZE> s_cosTable;
-  static bool s_trigTablesInitialized;
-
-  // Vertex Offset Memoization (fast canvas vertex calculations)
-  struct VertexOffsets {
-    sf::Vector2f topLeft, topRight, bottomLeft, bottomRight;
-  };
-  std::unordered_map<uint32_t, VertexOffsets> m_vertexOffsetCache; // Memoized by scale hash
-
-  // Alpha Fade Lookup Table (smooth transitions)
-  static constexpr size_t FADE_TABLE_SIZE = 256;
-  static std::array<uint8_t, FADE_TABLE_SIZE> s_fadeTable;
-
-  // Fast Division with Bit Shifting (power-of-2 optimizations)
-  static constexpr float CELL_WIDTH_SHIFT = 8.0f;  // 256 pixels per cell (2^8)
-  static constexpr float CELL_HEIGHT_SHIFT = 8.0f; // Fast bit-shift division
-  static constexpr int CELL_SHIFT_BITS = 8;        // For >> 8 operations
-
-  // Vertex Template Caching (typed array pattern from Canvas API)
-  struct VertexTemplate {
-    std::array<sf::Vector2f, 6> positions; // Relative positions
-    std::array<sf::Vector2f, 6> texCoords; // Texture coordinates
-    bool initialized = false;
+  std::vector<TemporarySprite> m_temporarySprites;
+
+  // Particle store (structure of arrays over a fixed pool)
+  // Live particles are packed in [0, count): acquire appends at the tail and
+  // release swap-removes, so the integration loops run over contiguous floats
+  // the compiler can vectorize, with no per-frame allocation or compaction.
+  static constexpr size_t PARTICLE_POOL_SIZE = 16384; // Comfortably above 10k live particles
+  struct ParticlePool {
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> gravity;
+    std::vector<float> life;        // Remaining lifetime in seconds
+    std::vector<float> invLifetime; // 1 / total lifetime, for the fade ratio
+    std::vector<float> halfSize;    // Half of the rendered quad edge in pixels
+    std::vector<float> texLeft, texTop, texRight, texBottom;
+    std::vector<uint8_t> fadeOut;
+    size_t count = 0;
+
+    void allocate(size_t capacity);
   };
-  std::unordered_map<uint64_t, VertexTemplate> m_vertexTemplateCache; // By type+scale hash
-
-  // 2. Dirty Flag Optimization (inspired by web browser dirty rectangles)
-  bool m_particlesDirty = false;                 // Track if VertexArray needs rebuilding
-  sf::Time m_lastVertexRebuild = sf::Time::Zero; // Prevent excessive rebuilds
-  static constexpr float VERTEX_REBUILD_THROTTLE = 1.0f / 120.0f; // Max 120 rebuilds/sec
-
-  // 3. VertexArray Double Buffering (inspired by OpenGL front/back buffer)
-  sf::VertexArray m_particleVertices;     // Current frame vertices
-  sf::VertexArray m_particleVerticesBack; // Next frame vertices (for smooth updates)
+  ParticlePool m_particlePool;
+
+  // Particle budget state
+  static constexpr size_t DEFAULT_PARTICLE_BUDGET = 4096;
+  size_t m_particleBudget = DEFAULT_PARTICLE_BUDGET;
+  float m_targetFrameTime = 1.0f / 60.0f;
+  float m_smoothedFrameTime = 1.0f / 60.0f; // Moving average of the frame work time
+  ParticleBudgetStats m_budgetStats;
+
+  // Persistent vertex buffer: 6 vertices per pooled particle, written in place
+  std::vector<sf::Vertex> m_particleVertices;
+  size_t m_particleVertexCount = 0;
   sf::Texture* m_particleTexture;
 
-  // 4. Spatial Partitioning for Culling (inspired by game engines)
-  struct SpatialCell {
-    std::vector<size_t> particleIndices;
-    sf::FloatRect bounds;
-    bool visible = true; // Frustum culling flag
-  };
-  static constexpr int SPATIAL_GRID_SIZE = 8; // 8x8 grid
-  std::array<std::array<SpatialCell, SPATIAL_GRID_SIZE>, SPATIAL_GRID_SIZE> m_spatialGrid;
-  sf::FloatRect m_viewBounds; // Current camera view for culling
-
-  // 5. Instanced Rendering Optimization (inspired by OpenGL instancing)
-  struct ParticleInstanceData {
-    sf::Vector2f position;
-    sf::Vector2f scale;
-    float rotation;
-    sf::Color color;
+  // GPU-simulated bursts, one static vertex buffer each
+  struct GpuBurst {
+    std::unique_ptr<sf::VertexBuffer> buffer;
+    std::vector<sf::Vertex> vertices; // Client-side fallback when buffers are unsupported
+    const sf::Texture* texture = nullptr;
+    sf::Vector2f origin;
+    float age = 0.0f;
+    float lifetime = 0.0f;
+    float gravity = 0.0f;
+    float halfSize = 0.0f;
+    float reach = 0.0f; // Culling radius around origin
+    bool fadeOut = true;
+    bool scaleDown = false;
+    size_t particleCount = 0;
   };
-  std::vector<ParticleInstanceData> m_instanceData; // GPU-friendly data layout
+  enum class BurstShaderState { Untried, Ready, Unavailable };
+  std::vector<std::unique_ptr<GpuBurst>> m_gpuBursts;
+  sf::Shader m_burstShader;
+  BurstShaderState m_burstShaderState = BurstShaderState::Untried;
+  bool m_gpuParticlesEnabled = true;
+  size_t m_gpuParticleCount = 0;
+
+  // Shared view culling grid, owned by Game; particles are binned by cell
+  // each draw so only the visible cells produce vertices
+  SpatialGrid* m_cullingGrid = nullptr;
+  std::vector<int> m_particleCells;
+  CellBins m_particleBins;
 
   // Oscillator state
   float oscillator;
@@ -270,42 +250,20 @@ private:
   // Object Pooling Pattern
   void initializeParticlePool();
   size_t acquireParticle();           // O(1) allocation from pool
-  void releaseParticle(size_t index); // O(1) deallocation to pool
-
-  // Dirty Flag & RequestAnimationFrame-style throttling
-  void markParticlesDirty() { m_particlesDirty = true; }
-  bool shouldRebuildVertices(sf::Time currentTime) const;
-  void throttledVertexRebuild(sf::Time currentTime);
-
-  // Spatial Partitioning & Frustum Culling
-  void initializeSpatialGrid();
-  void updateSpatialPartitioning();
-  void cullInvisibleParticles(const sf::FloatRect& viewBounds);
-  std::pair<int, int> getGridCell(const sf::Vector2f& position) const;
-  std::pair<int, int> getGridCellFast(const sf::Vector2f& position) const; // Bit-shift version
-
-  // Web Performance Patterns: Precalculation & Memoization
-  static void initializeTrigTables();      // Lookup tables for sin/cos
-  static float fastSin(int degrees);       // O(1) trigonometry
-  static float fastCos(int degrees);       // O(1) trigonometry
-  void initializeFadeTable();              // Alpha transition lookup
-  uint8_t getFadeAlpha(float ratio) const; // O(1) fade calculation
-
-  // Canvas-style Vertex Memoization
-  const VertexOffsets& getVertexOffsets(float scale);              // Memoized vertex calculations
-  const VertexTemplate& getVertexTemplate(uint64_t typeScaleHash); // Cached templates
-  uint32_t hashScale(float scale) const;                           // Hash function for memoization
-  uint64_t hashTypeScale(const sf::IntRect& rect, float scale) const; // Template hash
-
-  // Instanced Rendering Data Preparation
-  void prepareInstanceData();
-  void addParticleToVertexArrayOptimized(const CircleParticle& particle, size_t index);
-  void addParticleToVertexArrayPrecalc(const CircleParticle& particle,
-                                       size_t index); // Precalc version
+  void releaseParticle(size_t index); // O(1) swap-remove back to pool
+  void writeParticleVertices();
+  sf::Vertex* writeParticleQuad(size_t index, sf::Vertex* vertex) const; // Visible particles only
+  int budgetedParticleCount(int requested, ParticleConfig::Priority priority) const;
+  static sf::Vector2f burstVelocity(const ParticleConfig& config, int i, int count);
+
+  // GPU burst path
+  void createGpuBurst(sf::Vector2f position, const ParticleConfig& config, int particleCount,
+                      const sf::Texture* texture);
+  void updateGpuBursts(float deltaSeconds);
+  void drawGpuBursts(sf::RenderTarget& target);
 
   // Simple particle metrics (no redundant FPS counter)
   void logPerformanceMetrics() const;
-  void addParticleToVertexArray(const CircleParticle& particle);
 };
 
 // Predefined particle configurations for different collectible types
@@ -322,7 +280,8 @@ constexpr GameAnimationSystem::ParticleConfig DIAMOND_BURST = {
     true,                                                       // fadeOut
     false,                                                      // scaleDown
     0.0f,                                                       // gravity
-    GameAnimationSystem::ParticleConfig::BurstPattern::CIRCLE   // pattern
+    GameAnimationSystem::ParticleConfig::BurstPattern::CIRCLE,  // pattern
+    GameAnimationSystem::ParticleConfig::Priority::HIGH         // priority
 };
 
 // Card collection effect - enhanced for spectacular visibility
@@ -337,7 +296,8 @@ constexpr GameAnimationSystem::ParticleConfig CARD_COLLECT = {
     true,                                                     // fadeOut
     true,                                                     // scaleDown
     0.0f,                                                     // gravity
-    GameAnimationSystem::ParticleConfig::BurstPattern::CIRCLE // pattern
+    GameAnimationSystem::ParticleConfig::BurstPattern::CIRCLE,// pattern
+    GameAnimationSystem::ParticleConfig::Priority::NORMAL     // priority
 };
 
 // Card collection effect (random explosion pattern) - enhanced for spectacular visibility
@@ -352,7 +312,8 @@ constexpr GameAnimationSystem::ParticleConfig CARD_COLLECT_RANDOM = {
     true,                                                        // fadeOut
     true,                                                        // scaleDown
     0.0f,                                                        // gravity
-    GameAnimationSystem::ParticleConfig::BurstPattern::EXPLOSION // pattern
+    GameAnimationSystem::ParticleConfig::BurstPattern::EXPLOSION,// pattern
+    GameAnimationSystem::ParticleConfig::Priority::LOW           // priority
 };
 
 // Stop card effect (falling particles) - enhanced for spectacular visibility
@@ -367,7 +328,8 @@ constexpr GameAnimationSystem::ParticleConfig STOP_CARD = {
     true,                                                          // fadeOut
     false,                                                         // scaleDown
     98.0f,                                                         // gravity
-    GameAnimationSystem::ParticleConfig::BurstPattern::DIRECTIONAL // pattern
+    GameAnimationSystem::ParticleConfig::BurstPattern::DIRECTIONAL,// pattern
+    GameAnimationSystem::ParticleConfig::Priority::NORMAL          // priority
 };
 } // namespace ParticlePresets
 
@@ -21,8 +21,6 @@ void GameCore::initBoard() {
   game->paganHolidayString = getHoliday(month, day);
   game->paganHolidayTxt->setString(game->paganHolidayString);
 
-  game->sfxClick.setBuffer(game->sfxClickBuffer);
-  game->sfxDone.setBuffer(game->sfxDoneBuffer);
   game->spriteBackgroundDark->setTexture(game->textures.backgroundDark);
   game->spriteBackgroundDark->setPosition(sf::Vector2f(0, 0));
   game->spriteLestBegin->setTexture(game->textures.textureLetsBegin);
@@ -105,7 +103,7 @@ void GameCore::setCurrentNeighbours() {
 }
 
 void GameCore::endGame() {
-  game->musicGame.stop();
+  game->music.stop("game");
   game->currentState = Game::state_end_game;
   game->downTimeCounter = 0;
   game->numberFinishedPlayers = 4;
@@ -114,6 +112,7 @@ void GameCore::endGame() {
 void GameCore::throwDiceMove() {
   // Throw a dice action
   game->diceResultPlayer = game->roundDice.throwDiceSix();
+  game->sfx.playDice();
   game->players[game->turn].characters[0].diceResult = game->diceResultPlayer;
   game->currentState = Game::state_game;
   game->bubble.state = BubbleState::MOVE;
@@ -139,7 +138,7 @@ void GameCore::playerMakeMove(int mousePos) {
       startDeerMode();
     }
 
-    game->sfx.soundPortal.play();
+    game->sfx.playPortal();
     game->numberFinishedPlayers += 1;
     if (game->numberFinishedPlayers > 3) {
       endGame();
@@ -234,7 +233,7 @@ void GameCore::launchNextPlayer() {
       game->players[i].setActive(false);
   }
 
-  game->sfxClick.play();
+  game->sfx.playClick();
   game->diceResultPlayer = 6;
   game->roundDice.setDiceTexture(game->diceResultPlayer);
 
@@ -284,7 +283,7 @@ void GameCore::startDeerMode() {
   game->deerModeCounter = 16;
   game->banner.setText("deer mode");
   game->bigDiamondActive = false;
-  game->sfx.soundDeerMode.play();
+  game->sfx.playDeerMode();
 }
 
 void GameCore::command(const std::string& command) {
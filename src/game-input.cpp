@@ -2,6 +2,7 @@
 
 #include "board-initialization-animator.h"
 #include "game.h"
+#include "profiler.h"
 #include "tilemap.h" // For TILE_SIZE, BOARD_SIZE, transCords
 
 namespace DP {
@@ -16,7 +17,7 @@ void GameInput::processEvents(sf::RenderWindow& window) {
     const sf::Event& event = *eventOpt;
 
     if (event.is<sf::Event::Closed>()) {
-      window.close();
+      game->closeWindow();
       return;
     }
 
@@ -54,7 +55,7 @@ void GameInput::handleKeyboardInput(const sf::Event& event) {
       // Context-aware Escape behavior
       if (game->currentState == Game::state_menu) {
         // If in menu, exit the game
-        game->window.close();
+        game->closeWindow();
       } else {
         // If in game, go back to menu
         game->stateManager->showMenu();
@@ -91,6 +92,16 @@ void GameInput::handleKeyboardInput(const sf::Event& event) {
 #endif
     }
 
+#ifdef DEERPORTAL_PROFILER
+    // Profiler: F9 toggles the flame bar, F10 dumps a Chrome trace
+    if (keyPressed->code == sf::Keyboard::Key::F9) {
+      DP::Profiler::getInstance().toggleFlameBar();
+    }
+    if (keyPressed->code == sf::Keyboard::Key::F10) {
+      DP::Profiler::getInstance().exportChromeTrace("deerportal-trace.json");
+    }
+#endif
+
     // Additional keyboard handling can be added here
   }
 }
@@ -310,7 +321,7 @@ void GameInput::processLetsBeginInput(sf::Vector2f pos, sf::Vector2f posFull, in
 void GameInput::processEndGameInput(sf::Vector2f pos, sf::Vector2f posFull, int mousePos) {
   if (game->downTimeCounter > 2) {
     game->currentState = Game::state_menu;
-    game->musicMenu.play();
+    game->music.play("menu");
     game->restartGame();
   }
 }
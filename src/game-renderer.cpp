@@ -5,7 +5,9 @@
 #include <stdexcept>
 
 #include "board-initialization-animator.h"
+#include "draw-stats.h"
 #include "game.h"
+#include "profiler.h"
 
 namespace DP {
 
@@ -40,7 +42,118 @@ GameRenderer::GameRenderer(Game* gameInstance)
       enableShaders(false) // Performance: Disable shaders by default
       ,
       useDirectRendering(true) // Performance: Skip render-to-texture for gameplay
-{}
+      ,
+      diamondsRevision(0), cardsRevision(0), diceRevision(0), selectorRevision(0),
+      selectorShown(false) {
+  setupLayers();
+}
+
+/*!
+ * \brief GameRenderer::setupLayers registers the gameplay layers in draw order.
+ * Background art, the board (card piles, dice, selector, HUD) and the diamonds only
+ * change on game events and are cached; characters, particles and the player GUI
+ * are redrawn every frame.
+ */
+void GameRenderer::setupLayers() {
+  compositor.setLayer(
+      LayerCompositor::LAYER_BACKGROUND,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewFull);
+        target.draw(*game->spriteBackgroundDark);
+        DrawStats::count();
+        target.setView(game->viewTiles);
+        for (int i = 0; i < 4; i++) {
+          target.draw(game->players[i].elems);
+        }
+        target.setView(game->viewFull);
+        target.draw(*game->spriteBackgroundArt);
+        DrawStats::count();
+      },
+      true);
+
+  compositor.setLayer(
+      LayerCompositor::LAYER_BOARD,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewFull);
+        target.draw(game->cardsDeck);
+        target.draw(*game->roundDice.spriteDice);
+        DrawStats::count();
+        // Selector sits under the HUD and the diamonds, as in drawBaseGame
+        if (game->showPlayerBoardElems) {
+          target.setView(game->viewTiles);
+          target.draw(game->selector);
+          target.setView(game->viewFull);
+        }
+        target.draw(game->groupHud);
+      },
+      true);
+
+  compositor.setLayer(
+      LayerCompositor::LAYER_DIAMONDS,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewTiles);
+        target.draw(game->boardDiamonds);
+      },
+      true);
+
+  compositor.setLayer(
+      LayerCompositor::LAYER_CHARACTERS,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewTiles);
+        drawCharacters(target);
+        target.draw(game->bubble);
+      },
+      false);
+
+  compositor.setLayer(
+      LayerCompositor::LAYER_PARTICLES,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewFull);
+        game->getAnimationSystem()->drawCircleParticles(target);
+      },
+      false);
+
+  compositor.setLayer(
+      LayerCompositor::LAYER_UI,
+      [this](sf::RenderTarget& target) {
+        target.setView(game->viewFull);
+        drawPlayersGui(target);
+        if (game->bigDiamondActive) {
+          target.draw(*game->spriteBigDiamond);
+          DrawStats::count();
+        }
+      },
+      false);
+}
+
+/*!
+ * \brief GameRenderer::renderGameplayLayers draws state_game/state_roll_dice
+ * through the layer compositor. Diamond, card pile, dice and selector changes are
+ * picked up from their revision counters and the selector position; other dirty
+ * events come via invalidateLayer().
+ */
+void GameRenderer::renderGameplayLayers() {
+  DP_PROFILE_ZONE("GameRenderer::renderGameplayLayers");
+  if (game->boardDiamonds.getRevision() != diamondsRevision) {
+    diamondsRevision = game->boardDiamonds.getRevision();
+    compositor.invalidate(LayerCompositor::LAYER_DIAMONDS);
+  }
+  if (game->cardsDeck.getRevision() != cardsRevision ||
+      game->roundDice.getRevision() != diceRevision ||
+      game->selector.getRevision() != selectorRevision ||
+      game->selector.getPosition() != selectorPosition ||
+      game->showPlayerBoardElems != selectorShown) {
+    cardsRevision = game->cardsDeck.getRevision();
+    diceRevision = game->roundDice.getRevision();
+    selectorRevision = game->selector.getRevision();
+    selectorPosition = game->selector.getPosition();
+    selectorShown = game->showPlayerBoardElems;
+    compositor.invalidate(LayerCompositor::LAYER_BOARD);
+  }
+
+  compositor.composite(game->renderTexture);
+  game->renderTexture.setView(game->viewFull);
+}
 
 GameRenderer::~GameRenderer() {}
 
@@ -119,32 +232,8 @@ void GameRenderer::clearBuffers() {
 }
 
 void GameRenderer::renderStateGame() {
-  game->renderTexture.setView(game->viewFull);
-  game->renderTexture.draw(*game->spriteBackgroundDark);
-
-  game->renderTexture.setView(game->viewTiles);
-  drawBaseGame();
-
-  game->renderTexture.setView(game->viewFull);
-  game->renderTexture.draw(game->groupHud);
-
-  game->renderTexture.setView(game->viewTiles);
-  game->renderTexture.draw(game->boardDiamonds);
-  drawCharacters();
-  game->renderTexture.draw(game->bubble);
-
-  // Draw particles LAST so they appear on top
-#ifndef NDEBUG
-  std::cout << "DEBUG: About to draw particles in render-to-texture path" << std::endl;
-#endif
-  game->getAnimationSystem()->drawCircleParticles(game->renderTexture);
-
-  game->renderTexture.setView(game->viewFull);
-  drawPlayersGui();
-  game->renderTexture.setView(game->viewFull);
-
-  // Draw Big Diamond ONLY when game board is active
-  if (game->bigDiamondActive) game->renderTexture.draw(*game->spriteBigDiamond);
+  // Static layers come from the compositor cache, dynamic ones are redrawn
+  renderGameplayLayers();
 }
 
 void GameRenderer::renderStateSetup() {
@@ -298,8 +387,12 @@ void GameRenderer::renderStateEndGame() {
 }
 
 void GameRenderer::drawPlayersGui() {
+  drawPlayersGui(game->renderTexture);
+}
+
+void GameRenderer::drawPlayersGui(sf::RenderTarget& target) {
   for (int i = 0; i < 4; i++) {
-    game->renderTexture.draw(game->players[i]);
+    target.draw(game->players[i]);
   }
 }
 
@@ -353,20 +446,24 @@ void GameRenderer::drawBaseGame() {
 }
 
 void GameRenderer::drawCharacters() {
+  drawCharacters(game->renderTexture);
+}
+
+void GameRenderer::drawCharacters(sf::RenderTarget& target) {
   if (game->currentState == Game::state_game) {
     std::array<int, 2> currentMovements =
         game->players[game->turn].characters[0].getMovements(game->diceResultPlayer);
 
     if (currentMovements[1] > -1) {
-      if (game->nextRotateElem.active) game->renderTexture.draw(game->nextRotateElem);
+      if (game->nextRotateElem.active) target.draw(game->nextRotateElem);
     }
 
     if (currentMovements[0] > -1) {
-      if (game->prevRotateElem.active) game->renderTexture.draw(game->prevRotateElem);
+      if (game->prevRotateElem.active) target.draw(game->prevRotateElem);
     }
   }
 
-  game->renderTexture.setView(game->viewFull);
+  target.setView(game->viewFull);
   game->shaderBlur.setUniform("blur_radius", 0.005f);
 
   for (int i = 0; i < 4; i++) {
@@ -376,7 +473,7 @@ void GameRenderer::drawCharacters() {
       else
         j.drawMovements = false;
 
-      game->renderTexture.draw(j);
+      target.draw(j);
     }
   }
 }
@@ -2,6 +2,7 @@
 #define GAME_RENDERER_H
 
 #include <SFML/Graphics.hpp>
+#include "layer-compositor.h"
 #include "lighting-manager.h"
 
 namespace DP {
@@ -32,6 +33,14 @@ public:
   void drawSquares();
   void drawBaseGame();
   void drawCharacters();
+  void drawCharacters(sf::RenderTarget& target);
+  void drawPlayersGui(sf::RenderTarget& target);
+
+  // Layered gameplay rendering
+  void renderGameplayLayers();
+  void invalidateLayer(LayerCompositor::Layer layer) { compositor.invalidate(layer); }
+  void invalidateLayers() { compositor.invalidateAll(); }
+  LayerCompositor& getCompositor() { return compositor; }
 
   // View and shader management
   void setView(int viewType);
@@ -56,6 +65,16 @@ private:
   // Lighting system
   LightingManager lightingManager;
 
+  // Cached gameplay layers (background, board, diamonds) plus dynamic layers
+  LayerCompositor compositor;
+  unsigned int diamondsRevision;
+  unsigned int cardsRevision;
+  unsigned int diceRevision;
+  unsigned int selectorRevision;
+  sf::Vector2f selectorPosition;
+  bool selectorShown;
+  void setupLayers();
+
   // Performance optimization variables
   float runningCounter;
   float fpsDisplayUpdateTimer;
@@ -89,6 +89,8 @@ void GameStateManager::handleStateChange(int fromState, int toState) {
   }
 
   logStateTransition(fromState, toState);
+  // Before the audio, so sounds of the new state are loaded
+  game->assetStreamer.setState(toState);
   handleStateAudio(toState);
 }
 
@@ -98,6 +100,7 @@ bool GameStateManager::validateStateTransition(int newState) const {
 
 // Menu system management (extracted from game.cpp)
 void GameStateManager::showMenu() {
+  game->assetStreamer.setState(Game::state_menu);
   startMenuMusic();
   game->currentState = Game::state_menu;
   // Clear any active card notifications when returning to menu
@@ -109,12 +112,13 @@ void GameStateManager::hideMenu() {
 }
 
 void GameStateManager::showIntroShader() {
+  game->assetStreamer.setState(Game::state_intro_shader);
   // Start intro shader animation with menu music
   startMenuMusic();
 
   // Initialize intro shader with the pre-loaded intro menu image
   if (!game->introShader.initialize(sf::Vector2u(game->screenSize.x, game->screenSize.y),
-                                    &game->textureIntroMenu)) {
+                                    &game->textures.textureMenu)) {
     std::cerr << "Failed to initialize intro shader, going to menu" << std::endl;
     showMenu();
     return;
@@ -124,6 +128,7 @@ void GameStateManager::showIntroShader() {
 }
 
 void GameStateManager::showGameBoard() {
+  game->assetStreamer.setState(Game::state_setup_players);
   // Stop menu music and start game music
   stopMenuMusic();
   startGameMusic();
@@ -139,6 +144,7 @@ void GameStateManager::showGameBoard() {
 
 // Game flow control (extracted from game.cpp)
 void GameStateManager::endGame() {
+  game->assetStreamer.setState(Game::state_end_game);
   stopGameMusic();
   game->currentState = Game::state_end_game;
   game->downTimeCounter = 0;
@@ -253,22 +259,21 @@ void GameStateManager::prepareEndGameState() {
 }
 
 // Audio state management (extracted from game.cpp)
+// Crossfades; a track still being opened starts once it is ready
 void GameStateManager::startMenuMusic() {
-  game->musicMenu.play();
-  game->musicMenu.setLooping(true);
+  game->music.play("menu");
 }
 
 void GameStateManager::stopMenuMusic() {
-  game->musicMenu.stop();
+  game->music.stop("menu");
 }
 
 void GameStateManager::startGameMusic() {
-  game->musicGame.play();
-  game->musicGame.setLooping(true);
+  game->music.play("game");
 }
 
 void GameStateManager::stopGameMusic() {
-  game->musicGame.stop();
+  game->music.stop("game");
 }
 
 // State validation
@@ -1,16 +1,24 @@
 #include "game.h"
 
+#include "asset-loader.h"
 #include "board-initialization-animator.h"
+#include "draw-stats.h"
 #include "error-handler.h"
 #include "game-assets.h"
 #include "game-core.h"
 #include "game-input.h"
 #include "game-renderer.h"
+#include "profiler.h"
 #include "safe-asset-loader.h"
+#include "shared-assets.h"
+#include "startup-timer.h"
 
 // Include all headers that were moved from game.h
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <stdexcept>
+#include <utility>
 
 #include "animatedsprite.h"
 #include "banner.h"
@@ -135,8 +143,6 @@ void Game::initBoard() {
   paganHolidayString = getHoliday(month, day);
   paganHolidayTxt->setString(paganHolidayString);
 
-  sfxClick.setBuffer(sfxClickBuffer);
-  sfxDone.setBuffer(sfxDoneBuffer);
   spriteBackgroundDark->setTexture(textures.backgroundDark);
   spriteBackgroundDark->setPosition(sf::Vector2f(0, 0));
   spriteLestBegin->setTexture(textures.textureLetsBegin);
@@ -232,6 +238,7 @@ void Game::restartGame() {
   deerModeCounter = 16;
   bigDiamondActive = true; // Ensure big diamond is visible on game restart
   cardNotification.dismiss();
+  if (renderer) renderer->invalidateLayers();
 }
 
 void Game::setCurrentNeighbours() {
@@ -242,6 +249,7 @@ void Game::setCurrentNeighbours() {
  * \brief Game::loadAssets
  */
 void Game::loadAssets() {
+  DP_PROFILE_ZONE("Game::loadAssets");
 
   try {
     DeerPortal::SafeAssetLoader::loadFont(gameFont, ASSETS_PATH "fnt/metal-mania.regular.ttf");
@@ -254,11 +262,12 @@ void Game::loadAssets() {
     }
   }
 
-  try {
-    DeerPortal::SafeAssetLoader::loadFont(menuFont, ASSETS_PATH "fnt/metal-macabre.regular.ttf");
-  } catch (const DeerPortal::AssetLoadException& e) {
-    DeerPortal::ErrorHandler::getInstance().handleException(e);
-    menuFont = gameFont; // Use game font as fallback
+  // Same font the GUI windows hold, so it is opened only once
+  menuFont = DP::SharedAssets::getInstance().getFont("fnt/metal-macabre.regular.ttf");
+  if (!menuFont) {
+    DeerPortal::ErrorHandler::getInstance().handleException(DeerPortal::AssetLoadException(
+        DeerPortal::AssetLoadException::FONT, "fnt/metal-macabre.regular.ttf",
+        "Failed to load menu font, using game font"));
   }
 
   // Initialize sprites with textures for SFML 3.0
@@ -266,67 +275,27 @@ void Game::loadAssets() {
 
   spriteDeerGod = std::make_unique<sf::Sprite>(textures.textureDeerGod);
 
-  if (!shaderBlur.loadFromFile(get_full_path(ASSETS_PATH "shaders/blur.frag"),
-                               sf::Shader::Type::Fragment)) {
-    DeerPortal::ErrorHandler::getInstance().logError(
-        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SHADER, "blur.frag",
-                                       "Failed to load blur shader - visual effects disabled"));
-  }
-
-  if (!shaderPixel.loadFromFile(get_full_path(ASSETS_PATH "shaders/pixelate.frag"),
-                                sf::Shader::Type::Fragment)) {
-    DeerPortal::ErrorHandler::getInstance().logError(
-        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SHADER, "pixelate.frag",
-                                       "Failed to load pixelate shader - visual effects disabled"));
-  }
-  if (!shaderDark.loadFromFile(get_full_path(ASSETS_PATH "shaders/dark.frag"),
-                               sf::Shader::Type::Fragment)) {
-    DeerPortal::ErrorHandler::getInstance().logError(
-        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SHADER, "dark.frag",
-                                       "Failed to load dark shader - visual effects disabled"));
-  }
-
-  try {
-    DeerPortal::SafeAssetLoader::loadTexture(textureBackgroundArt,
-                                             ASSETS_PATH "img/background_land.png");
-  } catch (const DeerPortal::AssetLoadException& e) {
-    DeerPortal::ErrorHandler::getInstance().handleException(e);
-    DeerPortal::SafeAssetLoader::createFallbackTexture(textureBackgroundArt, sf::Color(0, 100, 0),
-                                                       sf::Vector2u(800, 600));
-  }
-
-  try {
-    DeerPortal::SafeAssetLoader::loadTexture(textureIntroMenu, ASSETS_PATH "img/dp_intro_menu.png");
-  } catch (const DeerPortal::AssetLoadException& e) {
-    DeerPortal::ErrorHandler::getInstance().handleException(e);
-    DeerPortal::SafeAssetLoader::createFallbackTexture(textureIntroMenu, sf::Color(50, 50, 50),
-                                                       sf::Vector2u(800, 600));
-  }
+  // Shaders are only queued here; compileShaders() builds them behind the loading screen
+  shaderManager.addFragmentFile("blur", shaderBlur, "shaders/blur.frag");
+  shaderManager.addFragmentFile("pixelate", shaderPixel, "shaders/pixelate.frag");
+  shaderManager.addFragmentFile("dark", shaderDark, "shaders/dark.frag");
+  shaderManager.addCustom("intro", introShader.getShader(),
+                          [this]() { return introShader.compileShader(); });
+  shaderManager.addCustom("particle burst", animationSystem->getBurstShader(),
+                          [this]() { return animationSystem->ensureBurstShader(); });
 
-  if (!musicGame.openFromFile(get_full_path(ASSETS_PATH "audio/game.ogg"))) {
-    DeerPortal::ErrorHandler::getInstance().logError(
-        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "game.ogg",
-                                       "Failed to load game music - audio disabled"));
-  }
   //    if (!musicBackground.openFromFile(ASSETS_PATH"assets/audio/wind2.ogg"))
   //        std::exit(1);
-  if (!musicMenu.openFromFile(get_full_path(ASSETS_PATH "audio/menu.ogg"))) {
-    DeerPortal::ErrorHandler::getInstance().logError(
-        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "menu.ogg",
-                                       "Failed to load menu music - audio disabled"));
-  }
+  // Streams are opened in the background, one state ahead of their music
+  music.addTrack("menu", "audio/menu.ogg", {state_init, state_intro_shader, state_end_game});
+  music.addTrack("game", "audio/game.ogg", {state_intro_shader, state_menu});
 
-  try {
-    DeerPortal::SafeAssetLoader::loadSound(sfxClickBuffer, ASSETS_PATH "audio/click.ogg");
-  } catch (const DeerPortal::AssetLoadException& e) {
-    DeerPortal::ErrorHandler::getInstance().handleException(e);
-  }
+  // The icon is tiny; everything else is streamed per state below
+  DP::AssetLoader loader;
+  sf::Image icon;
+  loader.addImage(icon, "img/deerportal.png", [](const DeerPortal::AssetLoadException&) {});
+  loader.load();
 
-  try {
-    DeerPortal::SafeAssetLoader::loadSound(sfxDoneBuffer, ASSETS_PATH "audio/done.ogg");
-  } catch (const DeerPortal::AssetLoadException& e) {
-    DeerPortal::ErrorHandler::getInstance().handleException(e);
-  }
   //    if (!textureBackground.loadFromFile(ASSETS_PATH"assets/img/background.png"))
   //        std::exit(1);
 
@@ -357,8 +326,7 @@ void Game::loadAssets() {
   textFPS->setString("FPS: --");
 
   // Load and set window icon (NEW 0.8.2 FEATURE)
-  sf::Image icon;
-  if (icon.loadFromFile(get_full_path(ASSETS_PATH "img/deerportal.png"))) {
+  if (icon.getSize().x > 0) {
     window.setIcon(icon.getSize(), icon.getPixelsPtr());
   }
 
@@ -372,6 +340,65 @@ void Game::loadAssets() {
     playersSprites[i]->setPosition(
         sf::Vector2f(playersSpritesCords[i][0], playersSpritesCords[i][1]));
   }
+
+  // Only the intro image blocks this loading screen; the intro shader and the
+  // menu background share it. Gameplay assets decode while the intro and menu
+  // run; each group is released again in states far from the ones that draw it.
+  DP::AssetStreamer::Manifest& menu = assetStreamer.addManifest(
+      "menu", {state_init, state_intro_shader, state_menu}, {state_end_game});
+  menu.addTexture(textures.textureMenu, "img/dp_intro_menu.png",
+                  "Failed to load intro menu texture",
+                  [this](const DeerPortal::AssetLoadException& e) {
+                    DeerPortal::ErrorHandler::getInstance().handleException(e);
+                    DeerPortal::SafeAssetLoader::createFallbackTexture(
+                        textures.textureMenu, sf::Color(50, 50, 50), sf::Vector2u(800, 600));
+                  });
+  menu.setOnLoaded([this]() { menuBackground->setTexture(textures.textureMenu, true); });
+
+  DP::AssetStreamer::Manifest& gameplay = assetStreamer.addManifest(
+      "gameplay",
+      {state_setup_players, state_board_animation, state_lets_begin, state_roll_dice, state_game,
+       state_gui_elem, state_select_building, state_gui_end_round, state_end_game},
+      {state_intro_shader, state_menu});
+  gameplay.addTexture(textureBackgroundArt, "img/background_land.png",
+                      "Failed to load background texture",
+                      [this](const DeerPortal::AssetLoadException& e) {
+                        DeerPortal::ErrorHandler::getInstance().handleException(e);
+                        DeerPortal::SafeAssetLoader::createFallbackTexture(
+                            textureBackgroundArt, sf::Color(0, 100, 0), sf::Vector2u(800, 600));
+                      });
+  gameplay.addTexture(textures.textureLetsBegin, "img/letsbegin.png",
+                      "Failed to load lets begin texture");
+  gameplay.addTexture(textures.textureDeerGod, "img/deer-god.png",
+                      "Failed to load deer god texture");
+  gameplay.addTexture(textures.textureBigDiamond, "img/diamond-big.png",
+                      "Failed to load big diamond texture");
+  const DP::AssetLoader::Fallback reportOnly = [](const DeerPortal::AssetLoadException& e) {
+    DeerPortal::ErrorHandler::getInstance().handleException(e);
+  };
+  gameplay.addSound(sfx.bufferClick, "audio/click.ogg", "Failed to load click sound", reportOnly);
+  sfx.addTo(gameplay);
+  gameplay.setOnLoaded([this]() {
+    spriteBackgroundArt->setTexture(textureBackgroundArt, true);
+    spriteLestBegin->setTexture(textures.textureLetsBegin, true);
+    spriteDeerGod->setTexture(textures.textureDeerGod, true);
+    spriteBigDiamond->setTexture(textures.textureBigDiamond, true);
+  });
+
+  currentState = state_init;
+  music.setState(currentState);
+  assetStreamer.setState(currentState,
+                         [this](std::size_t loaded, std::size_t total, const std::string& name) {
+                           drawLoadingScreen("loading: " + name,
+                                             static_cast<float>(loaded) / total);
+                         });
+}
+
+void Game::streamAssets() {
+  // Catches every state change, including direct assignments of currentState
+  assetStreamer.setState(currentState);
+  assetStreamer.update(sf::milliseconds(STREAM_BUDGET_MS));
+  music.setState(currentState);
 }
 
 void Game::throwDiceMove() {
@@ -382,6 +409,7 @@ void Game::throwDiceMove() {
 
   // Throw a dice action
   diceResultPlayer = roundDice.throwDiceSix();
+  sfx.playDice();
   players[turn].characters[0].diceResult = diceResultPlayer;
   currentState = state_game;
   bubble.state = BubbleState::MOVE;
@@ -410,7 +438,7 @@ void Game::playerMakeMove(int mousePos) {
       startDeerMode();
     }
 
-    sfx.soundPortal.play();
+    sfx.playPortal();
     numberFinishedPlayers += 1;
     if (numberFinishedPlayers > 3) {
       stateManager->endGame();
@@ -526,7 +554,7 @@ void Game::handleLeftClick(sf::Vector2f pos, sf::Vector2f posFull, int mousePos)
   if (currentState == state_end_game) {
     if (downTimeCounter > 2) {
       currentState = state_menu;
-      musicMenu.play();
+      music.play("menu");
       restartGame();
       return;
       //            restartGame();
@@ -543,12 +571,12 @@ Game::Game(bool newTestMode)
       roundNumber(1), guiRoundDice(&textures), boardDiamonds(&textures),
       window(sf::VideoMode(sf::Vector2u(DP::initScreenX, DP::initScreenY)),
              "Deerportal - game about how human can be upgraded to the Deer"),
-      turn(0), commandManager(*this), cardsDeck(&textures, &menuFont, &commandManager),
+      turn(0), commandManager(*this), cardsDeck(&textures, &gameFont, &commandManager),
       banner(&gameFont), cardNotification(&gameFont, &textures), bigDiamondActive(false),
-      credits(&gameFont), sfxClick(sfxClickBuffer), sfxDone(sfxDoneBuffer),
-      nextRotateElem(&textures), prevRotateElem(&textures), cpuTimeThinkingInterval(1.0f),
-      cardNotificationDelay(0.0f), deerModeCounter(4), deerModeActive(false), v1(0.0f),
-      fpsDisplayUpdateTimer(0.0f) {
+      credits(&gameFont), nextRotateElem(&textures), prevRotateElem(&textures),
+      cpuTimeThinkingInterval(1.0f), cardNotificationDelay(0.0f), deerModeCounter(4),
+      deerModeActive(false), v1(0.0f), fpsDisplayUpdateTimer(0.0f) {
+  DP::StartupTimer::getInstance().mark("game_members");
   testMode = newTestMode;
   // Initialize unique_ptr text members (these have font constructors)
   txtWinner = std::make_unique<sf::Text>(gameFont);
@@ -558,7 +586,7 @@ Game::Game(bool newTestMode)
   gameVersion = std::make_unique<sf::Text>(gameFont);
   menuTxt = std::make_unique<sf::Text>(gameFont);
   endGameTxt = std::make_unique<sf::Text>(gameFont);
-  textLoading = std::make_unique<sf::Text>(menuFont);
+  textLoading = std::make_unique<sf::Text>(gameFont);
   textFPS = std::make_unique<sf::Text>(gameFont); // Initialize FPS text
 
   // Sprite initialization will be done in loadAssets() where textures are available
@@ -580,7 +608,6 @@ Game::Game(bool newTestMode)
   playersSpritesCords[2][1] = 436;
 
   textLoading->setString("loading...");
-  textLoading->setFont(menuFont);
   textLoading->setPosition(sf::Vector2f(200, 200));
   textLoading->setFillColor(sf::Color::White);
   textLoading->setCharacterSize(10);
@@ -599,7 +626,6 @@ Game::Game(bool newTestMode)
   showPlayerBoardElems = false;
   // V-Sync is now properly configured in window creation and fullscreen toggle
 
-  std::srand(time(NULL));
   window.clear(sf::Color(55, 55, 55));
   renderTexture.draw(*textLoading);
   // window.display();
@@ -618,8 +644,16 @@ Game::Game(bool newTestMode)
   // Initialize lighting system
   lightingManager = std::make_unique<DP::LightingManager>();
 
+  // Share one broad-phase culling grid over the render texture
+  cullingGrid.setWorldBounds(sf::FloatRect({0.0f, 0.0f}, sf::Vector2f(renderTexture.getSize())));
+  animationSystem->setCullingGrid(&cullingGrid);
+  boardAnimator->setCullingGrid(&cullingGrid);
+  lightingManager->setCullingGrid(&cullingGrid);
+  DP::StartupTimer::getInstance().mark("modules");
+
   loadAssets();
-  textLoading->setFont(menuFont);
+  DP::StartupTimer::getInstance().mark("load_assets");
+  textLoading->setFont(menuFont ? *menuFont : gameFont);
   textLoading->setPosition(sf::Vector2f(200, 200));
   textLoading->setFillColor(sf::Color::White);
   textLoading->setCharacterSize(10);
@@ -627,6 +661,11 @@ Game::Game(bool newTestMode)
   renderTexture.draw(*textLoading);
   window.display();
 
+  compileShaders();
+  DP::StartupTimer::getInstance().mark("shaders");
+  cardNotification.precomputeLayouts();
+  DP::StartupTimer::getInstance().mark("card_layouts");
+
   gameVersion->setString("version: " + std::string(DEERPORTAL_VERSION) + "-" +
                          std::string(BASE_PATH));
   gameVersion->setFont(gameFont);
@@ -635,6 +674,7 @@ Game::Game(bool newTestMode)
   gameVersion->setCharacterSize(15);
 
   initBoard();
+  DP::StartupTimer::getInstance().mark("init_board");
   renderTexture.clear(sf::Color::Black);
   renderTexture.draw(*textLoading);
   renderTexture.display();
@@ -648,11 +688,85 @@ Game::Game(bool newTestMode)
   windowManager.initialize(window, "Deerportal - game about how human can be upgraded to the Deer");
   windowManager.updateView(renderTexture);
   windowManager.updateSpriteScaling(*renderSprite, window);
+  DP::StartupTimer::getInstance().mark("intro_setup");
+}
+
+void Game::presentFirstMenuFrame() {
+  // Skips the intro animation the way Escape does
+  stateManager->showMenu();
+  update(sf::Time::Zero);
+  streamAssets();
+  const std::uint64_t presented = presenter.getPresentedFrames();
+  render(0.0f);
+
+#ifdef DEERPORTAL_RENDER_THREAD
+  // The frame is only queued; wait until the render thread has shown it
+  sf::Clock waited;
+  while (presenter.isRunning() && presenter.getPresentedFrames() == presented &&
+         waited.getElapsedTime() < sf::seconds(1.0f)) {
+    sf::sleep(sf::milliseconds(1));
+  }
+#else
+  (void)presented;
+#endif
+  DP::StartupTimer::getInstance().mark("first_menu_frame");
+}
+
+void Game::compileShaders() {
+  DP_PROFILE_ZONE("Game::compileShaders");
+  while (!shaderManager.isComplete()) {
+    drawLoadingScreen("compiling shaders: " + shaderManager.getCurrentName(),
+                      shaderManager.getProgress());
+    shaderManager.compileNext();
+  }
+  textLoading->setString("loading...");
+  shaderManager.logReport();
+}
+
+void Game::drawLoadingScreen(const std::string& text, float progress) {
+  // Progress screen drawn straight to the window between loading steps
+  const sf::Vector2f barPosition(200.0f, 220.0f);
+  const float barWidth = 400.0f;
+  sf::RectangleShape barBack(sf::Vector2f(barWidth, 4.0f));
+  barBack.setPosition(barPosition);
+  barBack.setFillColor(sf::Color(60, 60, 60));
+  sf::RectangleShape bar(sf::Vector2f(barWidth * progress, 4.0f));
+  bar.setPosition(barPosition);
+  bar.setFillColor(sf::Color::White);
+
+  textLoading->setString(text);
+  window.setView(window.getDefaultView());
+  window.clear(sf::Color::Black);
+  window.draw(*textLoading);
+  window.draw(barBack);
+  window.draw(bar);
+  window.display();
 }
 
 bool Game::toggleFullscreen() {
+  // The window is recreated, so its context must be back on this thread; the
+  // next rendered frame restarts the render thread
+  presenter.stop();
+
   // Use window manager to toggle fullscreen with render texture and sprite support
-  return windowManager.toggleFullscreen(window, renderTexture, *renderSprite);
+  bool toggled = windowManager.toggleFullscreen(window, renderTexture, *renderSprite);
+  if (toggled) {
+    // The window manager restored the native size; start measuring afresh
+    dynamicResolution.reset();
+    renderSprite->setTexture(renderTexture.getTexture(), true);
+    renderTexture.setView(viewFull);
+    renderer->invalidateLayers();
+  }
+  return toggled;
+}
+
+void Game::closeWindow() {
+  presenter.stop();
+  window.close();
+}
+
+void Game::setFramePacing(FramePacer::Mode mode, float targetFps) {
+  windowManager.setFramePacing(window, mode, targetFps);
 }
 
 int Game::run() {
@@ -662,8 +776,13 @@ int Game::run() {
   }
 
   // Main game loop
+  DP::FramePacer& framePacer = windowManager.getFramePacer();
+  DP_PROFILE_THREAD("Main thread");
   while (window.isOpen()) {
+    DP_PROFILE_FRAME();
+    DP_PROFILE_ZONE("Frame");
     sf::Time frameTime = frameClock.restart();
+    framePacer.beginFrame();
 
     // handle events - SFML 3.0 variant-based event system
     float xpos = 320.0f;
@@ -676,24 +795,51 @@ int Game::run() {
 
     // All event handling (including mouse) is now managed by GameInput
     update(frameTime);
+    sfx.update(); // Starts the effects triggered this frame
+    music.update();
+    streamAssets();
     render(frameTime.asSeconds());
+
+    // Work time and the next deadline; presents are stamped where display() runs
+    framePacer.endFrame();
+
+    // With vsync the work time includes the swap wait, so only scale when
+    // the pacer does the waiting
+    if (framePacer.getMode() != DP::FramePacer::Mode::VSYNC &&
+        dynamicResolution.addFrame(framePacer.getLastWorkMs(),
+                                   1000.0f / framePacer.getTargetFps())) {
+      applyResolutionScale();
+    }
   }
 
   return 0; // Game ended normally
 }
 
 void Game::update(sf::Time frameTime) {
+  DP_PROFILE_ZONE("Game::update");
   // FPS calculation and display update (NEW 0.8.2 FEATURE)
   fpsDisplayUpdateTimer += frameTime.asSeconds();
   if (fpsDisplayUpdateTimer >= 0.25f) { // Update FPS display every 0.25 seconds
-    float fps = 1.0f / frameTime.asSeconds();
-    textFPS->setString("FPS: " + std::to_string(static_cast<int>(fps)));
+    // Percentiles of measured present intervals show pacing jitter, not just the average
+    const DP::FramePacer::FrameStats stats = windowManager.getFramePacer().getStats();
+    // Bursts cut short by the particle budget since start, and particles dropped
+    const DP::GameAnimationSystem::ParticleBudgetStats& budget =
+        animationSystem->getParticleBudgetStats();
+    char fpsLine[160];
+    std::snprintf(fpsLine, sizeof(fpsLine),
+                  "FPS: %d  p50 %.1f  p95 %.1f  p99 %.1f ms  res %d%%  throttled %u/%u (-%u)",
+                  static_cast<int>(stats.fps + 0.5f), stats.p50Ms, stats.p95Ms, stats.p99Ms,
+                  static_cast<int>(dynamicResolution.getScale() * 100.0f + 0.5f),
+                  budget.throttledBursts, budget.bursts, budget.droppedParticles);
+    textFPS->setString(fpsLine);
     fpsDisplayUpdateTimer = 0.0f;
   }
 
   runningCounter += frameTime.asSeconds();
 
-  // Update animation system for all states
+  // Update animation system for all states; the particle budget scales with
+  // the work time, since frameTime also holds the pacer's sleep
+  animationSystem->recordFrameWorkTime(getFrameWorkSeconds());
   animationSystem->update(frameTime);
 
   // PERFORMANCE OPTIMIZATION: State-aware conditional updates
@@ -761,6 +907,7 @@ void Game::update(sf::Time frameTime) {
 }
 
 void Game::updateGameplayElements(sf::Time frameTime) {
+  DP_PROFILE_ZONE("Game::updateGameplayElements");
   // Banner only when active
   if (banner.active) {
     banner.update(frameTime);
@@ -925,6 +1072,7 @@ void Game::updateGameplayElements(sf::Time frameTime) {
 }
 
 void Game::updateMinimalElements(sf::Time frameTime) {
+  DP_PROFILE_ZONE("Game::updateMinimalElements");
   // Only essential updates for transition states
   if (banner.active) {
     banner.update(frameTime);
@@ -1025,7 +1173,7 @@ void Game::launchNextPlayer() {
       players[i].setActive(false);
   }
 
-  sfxClick.play();
+  sfx.playClick();
   diceResultPlayer = 6;
   roundDice.setDiceTexture(diceResultPlayer);
 
@@ -1059,6 +1207,10 @@ void Game::launchNextPlayer() {
     }
     groupHud.setDeerModeCounter(number);
   }
+  // Active player board elements and the season/round HUD changed
+  renderer->invalidateLayer(LayerCompositor::LAYER_BACKGROUND);
+  renderer->invalidateLayer(LayerCompositor::LAYER_BOARD);
+
   currentState = state_roll_dice;
   bubble.state = BubbleState::DICE;
   roundDice.setColor(turn);
@@ -1156,36 +1308,156 @@ void Game::drawCharacters() {
  * \param deltaTime
  */
 void Game::render(float deltaTime) {
-  // All drawing is done to the renderTexture at a fixed 1360x768 resolution.
-  // The final result is then scaled to the window by the WindowManager's view.
+  DP_PROFILE_ZONE("Game::render");
+  // The scene is drawn to the renderTexture at 1360x768, or lower when the
+  // dynamic resolution scale drops, and then scaled to the window. Text
+  // overlays are drawn on top at window resolution.
+
+  if (currentState == state_intro_shader) {
+    // The intro shader has its own direct-to-window rendering path
+    presenter.stop();
+    window.clear(sf::Color::Black);
+    renderer->invalidateLayers();
+    introShader.render(window);
+    window.display();
+    windowManager.getFramePacer().recordPresent();
+    return;
+  }
+
+  renderScene(deltaTime);
+
+#ifdef DEERPORTAL_RENDER_THREAD
+  if (!presenter.isRunning() && !presenter.hasFailed()) {
+    presenter.start(window, windowManager.getFramePacer());
+  }
+  if (presenter.isRunning() && submitFrame()) {
+    return;
+  }
+  // The render thread could not start or gave up; present on this thread
+  presenter.stop();
+#endif
 
   window.clear(sf::Color::Black); // Clear window with black for letterboxing
+
+  // Set the final texture to the main render sprite
+  renderSprite->setTexture(renderTexture.getTexture());
+
+  // Apply blur shader to final render for performance
+  v1 = sin(deltaTime) * 0.015f;
+  shaderBlur.setUniform("blur_radius", 0.0003f);
+
+  // The WindowManager handles scaling and letterboxing via sprite positioning
+  // Apply shader to final scaled render for best performance
+  window.draw(*renderSprite, &shaderBlur);
+
+  // Text overlays go straight to the window after the upscale
+  const sf::View windowView = window.getView();
+  window.setView(getOverlayView());
+  renderOverlay(window);
+  window.setView(windowView);
+
+  window.display();
+  windowManager.getFramePacer().recordPresent();
+}
+
+bool Game::submitFrame() {
+  DP_PROFILE_ZONE("Game::submitFrame");
+  DP::FramePresenter::Frame* frame =
+      presenter.beginFrame(renderTexture.getSize(), window.getSize());
+  if (!frame) {
+    return false;
+  }
+
+  // Ping-pong: the finished scene moves into the slot and renderTexture takes
+  // the slot's spare texture, which beginFrame sized to match. The view and
+  // filtering are kept, since some states rely on the last view set.
+  const sf::View sceneView = renderTexture.getView();
+  const bool smooth = renderTexture.isSmooth();
+  std::swap(renderTexture, frame->scene);
+  renderTexture.setSmooth(smooth);
+  renderTexture.setView(sceneView);
+  frame->sceneScale = renderSprite->getScale();
+  frame->scenePosition = renderSprite->getPosition();
+
+  // The overlay texture matches the window, so the overlay view maps the same.
+  // Most release frames have no overlay and skip the full-window pass.
+  frame->hasOverlay = hasOverlay();
+  if (frame->hasOverlay) {
+    frame->overlay.clear(sf::Color::Transparent);
+    frame->overlay.setView(getOverlayView());
+    renderOverlay(frame->overlay);
+    frame->overlay.display();
+  }
+
+  // With vsync the render thread paces the game; otherwise the FramePacer does
+  presenter.publish(windowManager.getFramePacer().getMode() == DP::FramePacer::Mode::VSYNC);
+  return true;
+}
+
+float Game::getFrameWorkSeconds() const {
+  const DP::FramePacer& framePacer = windowManager.getFramePacer();
+  if (framePacer.getMode() == DP::FramePacer::Mode::VSYNC) {
+    return 0.0f;
+  }
+  return framePacer.getLastWorkMs() / 1000.0f;
+}
+
+void Game::applyResolutionScale() {
+  const float scale = dynamicResolution.getScale();
+  const sf::Vector2u size(static_cast<unsigned int>(screenSize.x * scale + 0.5f),
+                          static_cast<unsigned int>(screenSize.y * scale + 0.5f));
+  if (size == renderTexture.getSize()) {
+    return;
+  }
+
+  if (!renderTexture.resize(size)) {
+    std::cerr << "Failed to resize render texture to " << size.x << "x" << size.y
+              << ", dynamic resolution disabled" << std::endl;
+    dynamicResolution.setEnabled(false);
+    windowManager.updateRenderTextureSize(renderTexture, window);
+  }
+
+  // Bilinear filtering hides the stretch below native resolution
+  renderTexture.setSmooth(dynamicResolution.getScale() < 1.0f);
+  // Resizing resets the view; states like the menu rely on the last one set
+  renderTexture.setView(viewFull);
+  renderSprite->setTexture(renderTexture.getTexture(), true);
+  windowManager.updateSpriteScaling(*renderSprite, window, dynamicResolution.getScale());
+  // Cached layers must be redrawn at the new size
+  renderer->invalidateLayers();
+}
+
+sf::View Game::getOverlayView() const {
+  // Where the scene sprite ends up in window pixels, whatever view the window uses
+  const sf::FloatRect bounds = renderSprite->getGlobalBounds();
+  const sf::Vector2i topLeft = window.mapCoordsToPixel(bounds.position);
+  const sf::Vector2i bottomRight = window.mapCoordsToPixel(bounds.position + bounds.size);
+  const sf::Vector2f windowSize(window.getSize());
+
+  sf::View view = viewFull;
+  view.setViewport(sf::FloatRect(
+      sf::Vector2f(topLeft.x / windowSize.x, topLeft.y / windowSize.y),
+      sf::Vector2f((bottomRight.x - topLeft.x) / windowSize.x,
+                   (bottomRight.y - topLeft.y) / windowSize.y)));
+  return view;
+}
+
+void Game::renderScene(float deltaTime) {
+  DP_PROFILE_ZONE("Game::renderScene");
   renderTexture.clear();
 
   // --- Begin Drawing to RenderTexture ---
 
-  if ((currentState == state_game) || (currentState == state_roll_dice)) {
-    renderTexture.setView(viewFull);
-    renderTexture.draw(*spriteBackgroundDark);
-    renderTexture.setView(viewTiles);
-    drawBaseGame();
-    renderTexture.setView(viewFull);
-    renderTexture.draw(groupHud);
-    renderTexture.setView(viewTiles);
-    renderTexture.draw(boardDiamonds);
-    drawCharacters();
-    renderTexture.draw(bubble);
-    getAnimationSystem()->drawCircleParticles(renderTexture);
-    renderTexture.setView(viewFull);
-    drawPlayersGui();
-    renderTexture.setView(viewFull);
-    if (bigDiamondActive) renderTexture.draw(*spriteBigDiamond);
+  // Other states draw over the shared board elements without dirty events,
+  // so cached gameplay layers are rebuilt when gameplay resumes.
+  if ((currentState != state_game) && (currentState != state_roll_dice)) {
+    renderer->invalidateLayers();
+  }
 
-  } else if (currentState == state_intro_shader) {
-    // The intro shader has its own direct-to-window rendering path
-    introShader.render(window);
-    window.display();
-    return;
+  if ((currentState == state_game) || (currentState == state_roll_dice)) {
+    // Background, board and diamonds come from cached layers; only the
+    // characters, particles and player GUI are redrawn each frame.
+    renderer->renderGameplayLayers();
 
   } else if (currentState == state_setup_players) {
     renderTexture.setView(viewFull);
@@ -1217,7 +1489,7 @@ void Game::render(float deltaTime) {
 #endif
       // Initialize lighting manager if needed
       if (!boardAnimationLightingInitialized) {
-        if (lightingManager->initialize(renderTexture.getSize())) {
+        if (lightingManager->initialize(sf::Vector2u(screenSize))) {
           boardAnimationLightingInitialized = true;
 #ifndef NDEBUG
           std::cout << "LIGHTING: Initialized lighting system for board animation" << std::endl;
@@ -1227,6 +1499,7 @@ void Game::render(float deltaTime) {
       
       // Begin lighting frame with dynamic ambient color (fades from dark to bright)
       sf::Color ambientColor = boardAnimator->getCurrentAmbientColor();
+      lightingManager->recordFrameTime(getFrameWorkSeconds());
       lightingManager->beginFrame(ambientColor);
       
       // Update lights from animated diamonds
@@ -1277,13 +1550,14 @@ void Game::render(float deltaTime) {
       // Continue lighting effects for animated diamonds
       if (lightingManager) {
         if (!letsBeginLightingInitialized) {
-          if (lightingManager->initialize(renderTexture.getSize())) {
+          if (lightingManager->initialize(sf::Vector2u(screenSize))) {
             letsBeginLightingInitialized = true;
 #ifndef NDEBUG
             std::cout << "LIGHTING: Initialized lighting system for lets_begin state" << std::endl;
 #endif
           }
         }
+        lightingManager->recordFrameTime(getFrameWorkSeconds());
         lightingManager->beginFrame(sf::Color(10, 10, 20, 255));
         boardAnimator->updateLights(*lightingManager);
         lightingManager->render(renderTexture);
@@ -1325,34 +1599,37 @@ void Game::render(float deltaTime) {
     }
   }
 
-  if (banner.active) renderTexture.draw(banner);
-  if (cardNotification.isActive()) renderTexture.draw(cardNotification);
-
   renderTexture.setView(viewFull);
 
-#if defined(DEERPORTAL_SHOW_FPS_COUNTER) || !defined(NDEBUG)
-  renderTexture.draw(*textFPS);
-#endif
-#ifndef NDEBUG
-  renderTexture.draw(*gameVersion);
-#endif
-
   // --- End Drawing to RenderTexture ---
 
   // Finalize the texture
   renderTexture.display();
+}
 
-  // Set the final texture to the main render sprite
-  renderSprite->setTexture(renderTexture.getTexture());
+void Game::renderOverlay(sf::RenderTarget& target) {
+  if (banner.active) target.draw(banner);
+  if (cardNotification.isActive()) target.draw(cardNotification);
 
-  // Apply blur shader to final render for performance
-  v1 = sin(deltaTime) * 0.015f;
-  shaderBlur.setUniform("blur_radius", 0.0003f);
+#if defined(DEERPORTAL_SHOW_FPS_COUNTER) || !defined(NDEBUG)
+  target.draw(*textFPS);
+  DP::DrawStats::count();
+#endif
+#ifdef DEERPORTAL_PROFILER
+  DP::Profiler::getInstance().drawFlameBar(target, gameFont);
+#endif
+#ifndef NDEBUG
+  target.draw(*gameVersion);
+  DP::DrawStats::count();
+#endif
+}
 
-  // The WindowManager handles scaling and letterboxing via sprite positioning
-  // Apply shader to final scaled render for best performance
-  window.draw(*renderSprite, &shaderBlur);
-  window.display();
+bool Game::hasOverlay() const {
+#if defined(DEERPORTAL_SHOW_FPS_COUNTER) || defined(DEERPORTAL_PROFILER) || !defined(NDEBUG)
+  return true;
+#else
+  return banner.active || cardNotification.isActive();
+#endif
 }
 
 void Game::command(std::string command) {
@@ -1374,6 +1651,6 @@ void Game::startDeerMode() {
   deerModeCounter = 16;
   banner.setText("deer mode");
   bigDiamondActive = false;
-  sfx.soundDeerMode.play();
+  sfx.playDeerMode();
 }
 } // namespace DP
\ No newline at end of file
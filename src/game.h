@@ -17,6 +17,7 @@
 // Include headers for classes used as direct member variables (cannot be forward declared)
 #include "animatedsprite.h"   // For AnimatedSprite animatedSprite;
 #include "animation.h"        // For Animation members;
+#include "asset-streamer.h"   // For AssetStreamer assetStreamer;
 #include "banner.h"           // For Banner banner;
 #include "boarddiamondseq.h"  // For BoardDiamondSeq boardDiamonds;
 #include "bubble.h"           // For Bubble bubble;
@@ -26,12 +27,17 @@
 #include "command.h"          // For Command commandManager;
 #include "credits.h"          // For Credits credits;
 #include "data.h"             // For Player struct
+#include "dynamic-resolution.h" // For DynamicResolution dynamicResolution;
+#include "frame-presenter.h"  // For FramePresenter presenter;
 #include "grouphud.h"         // For GroupHud groupHud;
 #include "guirounddice.h"     // For GuiRoundDice guiRoundDice;
 #include "introshader.h"      // For IntroShader introShader;
+#include "music-controller.h" // For MusicController music;
 #include "rotateelem.h"       // For RotateElem members;
 #include "rounddice.h"        // For RoundDice roundDice;
+#include "scene-render-texture.h" // For SceneRenderTexture renderTexture;
 #include "selector.h"         // For Selector selector;
+#include "shader-manager.h"   // For ShaderManager shaderManager;
 #include "soundfx.h"          // For SoundFX sfx;
 #include "textureholder.h"    // For TextureHolder textures;
 #include "window-manager.h"   // For WindowManager windowManager;
@@ -64,6 +70,7 @@ class Game {
   friend class GameCore;
   friend class GameStateManager;
   friend class GameAnimationSystem;
+  friend class RenderBench;
 
 public:
   sf::Vector2i screenSize;
@@ -90,16 +97,32 @@ public:
   Game(bool newTestMode);
   int run(); // Main game loop extracted from constructor
 
+  /*!
+   * \brief presentFirstMenuFrame skips the intro and shows one menu frame
+   * For the startup benchmark; marks the end of startup in DP::StartupTimer.
+   */
+  void presentFirstMenuFrame();
+
   /*!
    * \brief Toggle fullscreen mode
    * \return true if toggle was successful, false otherwise
    */
   bool toggleFullscreen();
 
+  /*!
+   * \brief Stops the render thread and closes the window
+   */
+  void closeWindow();
+
+  // Selects how frames are paced; call before run()
+  void setFramePacing(FramePacer::Mode mode, float targetFps);
+
   BoardDiamondSeq boardDiamonds;
   sf::RenderWindow window;
   WindowManager windowManager; // NEW: Window manager for fullscreen handling
-  sf::RenderTexture renderTexture;
+  SceneRenderTexture renderTexture;
+  DynamicResolution dynamicResolution; // Scales renderTexture to the frame budget
+  FramePresenter presenter;            // Render thread; declared after window, stops first
   std::unique_ptr<sf::Sprite> renderSprite;
   Player players[4];
   SoundFX sfx;
@@ -109,6 +132,9 @@ private:
   void initBoard();
   void restartGame();
   void loadAssets();
+  void compileShaders(); // Loading screen phase, see ShaderManager
+  void streamAssets();   // Per frame: follows currentState, uploads background loads
+  void drawLoadingScreen(const std::string& text, float progress);
   void drawPlayersGui();
   void drawSquares();
   void drawMenu();
@@ -139,11 +165,10 @@ private:
   std::unique_ptr<sf::Sprite> spriteLestBegin;
   sf::Texture textureBackgroundArt;
   std::unique_ptr<sf::Sprite> spriteBackgroundArt;
-  sf::Texture textureIntroMenu; // NEW: Texture for intro menu image
   sf::Texture textureTiles;
   sf::Texture textureFaces;
   sf::Font gameFont;
-  sf::Font menuFont;
+  std::shared_ptr<const sf::Font> menuFont; // From SharedAssets, null means use gameFont
   std::unique_ptr<sf::Text> menuTxt;
   std::unique_ptr<sf::Text> endGameTxt;
   std::array<std::unique_ptr<sf::Text>, 4> endGameTxtAmount;
@@ -152,6 +177,7 @@ private:
   sf::Shader shaderBlur;
   sf::Shader shaderPixel;
   sf::Shader shaderDark;
+  ShaderManager shaderManager;
   int mapSize;
   int level[256];
   int levelElems[256];
@@ -163,6 +189,43 @@ private:
   void update(sf::Time frameTime);
   void render(float deltaTime);
 
+  /*!
+   * \brief renderScene draws the current state into renderTexture only
+   * Everything except the intro shader, which draws straight to the window.
+   */
+  void renderScene(float deltaTime);
+
+  /*!
+   * \brief renderOverlay draws banner, card notification and debug text
+   * Drawn after the scene is upscaled so text stays sharp at any scene
+   * resolution. The target's view must map the viewFull area.
+   */
+  void renderOverlay(sf::RenderTarget& target);
+  // False when renderOverlay would draw nothing this frame
+  bool hasOverlay() const;
+
+  /*!
+   * \brief applyResolutionScale resizes renderTexture to the dynamic resolution scale
+   */
+  void applyResolutionScale();
+
+  /*!
+   * \brief getFrameWorkSeconds is the last frame's cost without the pacer's sleep
+   * 0 with vsync, where the swap wait hides it; quality scalers skip 0
+   */
+  float getFrameWorkSeconds() const;
+
+  // View that maps viewFull onto the upscaled scene sprite in the window
+  sf::View getOverlayView() const;
+
+  /*!
+   * \brief submitFrame hands the rendered scene and overlay to the render thread
+   * renderTexture is swapped with the acquired slot's scene texture instead of
+   * copied, so the next frame renders into the texture the slot gave up.
+   * \return false if the frame could not be queued and must be presented here
+   */
+  bool submitFrame();
+
   void setCurrentNeighbours();
   void nextPlayer();
   void launchNextPlayer();
@@ -171,14 +234,7 @@ private:
   std::unique_ptr<sf::Sprite> menuBackground;
   std::array<std::unique_ptr<sf::Sprite>, 4> seasons;
 
-  sf::Music musicGame;
-  sf::Music musicMenu;
-
-  sf::SoundBuffer sfxClickBuffer;
-  sf::Sound sfxClick;
-
-  sf::SoundBuffer sfxDoneBuffer;
-  sf::Sound sfxDone;
+  MusicController music;
 
   GroupHud groupHud;
 
@@ -270,6 +326,9 @@ public:
   bool boardAnimationLightingInitialized = false;
   bool letsBeginLightingInitialized = false;
 
+  // View culling grid shared by particles, lights and the board animator
+  DP::SpatialGrid cullingGrid;
+
   // Module accessors
   GameAnimationSystem* getAnimationSystem() const { return animationSystem.get(); }
   TextureHolder& getTextures() { return textures; }
@@ -280,6 +339,13 @@ public:
   // Performance optimization methods
   void updateGameplayElements(sf::Time frameTime);
   void updateMinimalElements(sf::Time frameTime);
+
+private:
+  // Time per frame for uploading streamed assets
+  static constexpr int STREAM_BUDGET_MS = 2;
+
+  // Declared last so its decoder threads stop before the targets are destroyed
+  AssetStreamer assetStreamer;
 };
 } // namespace DP
 #endif // GAME_H
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "data.h"
+#include "draw-stats.h"
 #include "filetools.h"
 
 namespace DP {
@@ -102,10 +103,16 @@ void GroupHud::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   states.transform *= getTransform();
 
   // Draw season name (positioned via GroupHud transform)
-  if (seasonName) target.draw(*seasonName, states);
+  if (seasonName) {
+    target.draw(*seasonName, states);
+    DP::DrawStats::count();
+  }
 
   // Draw round name (positioned absolutely at bottom left)
-  if (roundName) target.draw(*roundName, states);
+  if (roundName) {
+    target.draw(*roundName, states);
+    DP::DrawStats::count();
+  }
 
   // Month is NOT drawn in original - commented out to match original behavior
   // if (monthName) target.draw(*monthName, states);
@@ -3,8 +3,9 @@
 #include <iostream> // For std::cerr
 
 #include "data.h" // For ASSETS_PATH
+#include "draw-stats.h"
 #include "exceptions.h"
-#include "filetools.h" // For get_full_path
+#include "shared-assets.h"
 
 void GuiWindow::setTitle(const std::string& newTitle) {
   title = newTitle;
@@ -14,25 +15,26 @@ void GuiWindow::setTitle(const std::string& newTitle) {
 }
 
 GuiWindow::GuiWindow(TextureHolder* textures) {
-  if (!guiElemFont.openFromFile(
-          get_full_path(std::string(ASSETS_PATH) + "fnt/metal-macabre.regular.ttf"))) {
+  guiElemFont = DP::SharedAssets::getInstance().getFont("fnt/metal-macabre.regular.ttf");
+  if (!guiElemFont) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::FONT,
                                          "fnt/metal-macabre.regular.ttf",
                                          "Failed to load GUI font metal-macabre.regular.ttf");
   }
 
   // Initialize text and sprites that depend on loaded resources
-  guiTitleTxt = std::make_unique<sf::Text>(guiElemFont); // Pass font here
+  guiTitleTxt = std::make_unique<sf::Text>(*guiElemFont); // Pass font here
   bgdDark = std::make_unique<sf::Sprite>(textures->backgroundDark);
   // spriteClose would also need its texture set here if it's from TextureHolder
   // if (textures->textureClose) spriteClose =
   // std::make_unique<sf::Sprite>(*textures->textureClose); For now, assuming spriteClose is handled
   // by derived classes or needs its own texture loading.
-  if (!textureClose.loadFromFile(get_full_path(std::string(ASSETS_PATH) + "img/gui/close.png"))) {
+  textureClose = DP::SharedAssets::getInstance().getTexture("img/gui/close.png");
+  if (!textureClose) {
     std::cerr << "Failed to load texture assets/img/gui/close.png" << std::endl;
     spriteClose = nullptr;
   } else {
-    spriteClose = std::make_unique<sf::Sprite>(this->textureClose);
+    spriteClose = std::make_unique<sf::Sprite>(*textureClose);
   }
 
   title = "Choose building:"; // Default title
@@ -45,28 +47,30 @@ GuiWindow::GuiWindow(TextureHolder* textures) {
 }
 
 GuiWindow::GuiWindow() {
-  if (!guiElemFont.openFromFile(
-          get_full_path(std::string(ASSETS_PATH) + "fnt/metal-macabre.regular.ttf"))) {
+  guiElemFont = DP::SharedAssets::getInstance().getFont("fnt/metal-macabre.regular.ttf");
+  if (!guiElemFont) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::FONT,
                                          "fnt/metal-macabre.regular.ttf",
                                          "Failed to load GUI font metal-macabre.regular.ttf");
   }
-  guiTitleTxt = std::make_unique<sf::Text>(guiElemFont); // Pass font here
+  guiTitleTxt = std::make_unique<sf::Text>(*guiElemFont); // Pass font here
 
   // Load texture for bgdDark (member textureBgdDark)
-  if (!textureBgdDark.loadFromFile(get_full_path(std::string(ASSETS_PATH) + "img/bgd-dark.png"))) {
+  textureBgdDark = DP::SharedAssets::getInstance().getTexture("img/bgd-dark.png");
+  if (!textureBgdDark) {
     std::cerr << "Failed to load texture assets/img/bgd-dark.png" << std::endl;
     // bgdDark will remain nullptr (default unique_ptr state)
   } else {
-    bgdDark = std::make_unique<sf::Sprite>(this->textureBgdDark);
+    bgdDark = std::make_unique<sf::Sprite>(*textureBgdDark);
   }
 
   // Load texture for spriteClose (member textureClose)
-  if (!textureClose.loadFromFile(get_full_path(std::string(ASSETS_PATH) + "img/gui/close.png"))) {
+  textureClose = DP::SharedAssets::getInstance().getTexture("img/gui/close.png");
+  if (!textureClose) {
     std::cerr << "Failed to load texture assets/img/gui/close.png" << std::endl;
     // spriteClose will remain nullptr (default unique_ptr state)
   } else {
-    spriteClose = std::make_unique<sf::Sprite>(this->textureClose);
+    spriteClose = std::make_unique<sf::Sprite>(*textureClose);
   }
 
   setPosition(sf::Vector2f(150, 100));
@@ -85,9 +89,18 @@ void GuiWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   sf::RenderStates states2 = states;
   states2.transform *= getTransform();
   Hover::draw(target, states);
-  if (bgdDark) target.draw(*bgdDark, states2);
-  if (spriteClose) target.draw(*spriteClose, states2);
-  if (guiTitleTxt) target.draw(*guiTitleTxt, states2);
+  if (bgdDark) {
+    target.draw(*bgdDark, states2);
+    DP::DrawStats::count();
+  }
+  if (spriteClose) {
+    target.draw(*spriteClose, states2);
+    DP::DrawStats::count();
+  }
+  if (guiTitleTxt) {
+    target.draw(*guiTitleTxt, states2);
+    DP::DrawStats::count();
+  }
 }
 
 std::string GuiWindow::getElem(sf::Vector2f mousePosition) {
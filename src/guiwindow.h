@@ -1,6 +1,7 @@
 #ifndef GUIWINDOW_H
 #define GUIWINDOW_H
 #include <iostream>
+#include <memory>
 
 #include <SFML/Graphics.hpp>
 
@@ -17,17 +18,17 @@ public:
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
   void init();
   virtual std::string getElem(sf::Vector2f mousePosition);
-  sf::Font guiElemFont;
+  std::shared_ptr<const sf::Font> guiElemFont; // Shared by all windows, see DP::SharedAssets
   std::string title;
   std::string description;
   std::unique_ptr<sf::Text> guiTitleTxt;
   //    sf::Texture* textureGui;
 
   std::unique_ptr<sf::Sprite> bgdDark;
-  sf::Texture textureBgdDark;
+  std::shared_ptr<const sf::Texture> textureBgdDark;
 
   std::unique_ptr<sf::Sprite> spriteClose;
-  sf::Texture textureClose;
+  std::shared_ptr<const sf::Texture> textureClose;
 
   void setTitle(const std::string& newTitle);
 
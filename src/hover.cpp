@@ -1,5 +1,7 @@
 #include "hover.h"
 
+#include "draw-stats.h"
+
 Hover::Hover() {
   width = 150;
   height = 100;
@@ -27,5 +29,8 @@ void Hover::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   //    states.texture = m_tileset;
 
   //    // draw the vertex array
-  if (active == true) target.draw(rectangle, states);
+  if (active == true) {
+    target.draw(rectangle, states);
+    DP::DrawStats::count();
+  }
 }
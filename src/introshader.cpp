@@ -2,24 +2,12 @@
 
 #include <iostream>
 
+#include "draw-stats.h"
 #include "tilemap.h" // For get_full_path
 
-namespace DP {
-
-IntroShader::IntroShader()
-    : initialized(false), finished(false), duration(8.0f), currentTime(0.0f) {}
-
-IntroShader::~IntroShader() {}
-
-bool IntroShader::initialize(sf::Vector2u screenSize) {
-  return initialize(screenSize, nullptr);
-}
-
-bool IntroShader::initialize(sf::Vector2u screenSize, const sf::Texture* backgroundTexture) {
-  this->screenSize = screenSize;
-
-  // New grid-based reveal shader that unveils the intro screen rectangle by rectangle
-  const std::string fragmentShaderGrid = R"(
+namespace {
+// New grid-based reveal shader that unveils the intro screen rectangle by rectangle
+const char* const fragmentShaderGrid = R"(
 #version 120
 
 // Grid-based reveal shader for DeerPortal intro
@@ -115,38 +103,71 @@ void main()
 }
 )";
 
-  // Try the new grid shader first
-  if (backgroundTexture && shader.loadFromMemory(fragmentShaderGrid, sf::Shader::Type::Fragment)) {
-    shader.setUniform("introTexture",
-                      *backgroundTexture); // Temporarily use background, will be replaced
-    shader.setUniform("useIntroTexture", true);
-  } else if (shader.loadFromMemory(fragmentShaderGrid, sf::Shader::Type::Fragment)) {
-    shader.setUniform("useIntroTexture", false);
-  } else {
-    // Final fallback to simple shader
-    const std::string simpleShader = R"(
+// Simple grid reveal fallback
+const char* const fragmentShaderSimple = R"(
 uniform float iTime;
 uniform vec2 iResolution;
 
 void main()
 {
     vec2 uv = gl_FragCoord.xy / iResolution.xy;
-    
+
     // Simple grid reveal fallback with tiny rectangles
     vec2 gridPos = floor(uv * vec2(95.0, 63.0));
     float cellIndex = gridPos.y * 95.0 + gridPos.x;
     float startTime = cellIndex * 0.002;  // Very fast for massive grid
     float progress = clamp((iTime - startTime) / 0.08, 0.0, 1.0);
-    
+
     vec3 color = vec3(0.4, 0.3, 0.2) * progress;
     gl_FragColor = vec4(color, 1.0);
 }
 )";
+} // namespace
+
+namespace DP {
+
+IntroShader::IntroShader()
+    : shaderVersion(SHADER_NONE), initialized(false), finished(false), duration(8.0f),
+      currentTime(0.0f) {}
+
+IntroShader::~IntroShader() {}
+
+bool IntroShader::initialize(sf::Vector2u screenSize) {
+  return initialize(screenSize, nullptr);
+}
+
+bool IntroShader::compileShader() {
+  if (shaderVersion != SHADER_NONE) {
+    return shaderVersion != SHADER_FAILED;
+  }
+
+  // Try the new grid shader first, then the simple fallback
+  if (shader.loadFromMemory(fragmentShaderGrid, sf::Shader::Type::Fragment)) {
+    shaderVersion = SHADER_GRID;
+  } else if (shader.loadFromMemory(fragmentShaderSimple, sf::Shader::Type::Fragment)) {
+    shaderVersion = SHADER_SIMPLE;
+  } else {
+    std::cerr << "Failed to load any intro shader version" << std::endl;
+    shaderVersion = SHADER_FAILED;
+  }
+  return shaderVersion != SHADER_FAILED;
+}
+
+bool IntroShader::initialize(sf::Vector2u screenSize, const sf::Texture* backgroundTexture) {
+  this->screenSize = screenSize;
+
+  // Normally compiled during the loading screen; compile now if it was not
+  if (!compileShader()) {
+    return false;
+  }
 
-    if (shader.loadFromMemory(simpleShader, sf::Shader::Type::Fragment)) {
+  if (shaderVersion == SHADER_GRID) {
+    if (backgroundTexture) {
+      shader.setUniform("introTexture",
+                        *backgroundTexture); // Temporarily use background, will be replaced
+      shader.setUniform("useIntroTexture", true);
     } else {
-      std::cerr << "Failed to load any intro shader version" << std::endl;
-      return false;
+      shader.setUniform("useIntroTexture", false);
     }
   }
 
@@ -203,10 +224,12 @@ void IntroShader::render(sf::RenderWindow& window) {
 
   // Render with shader
   renderTexture.draw(fullscreenQuad, &shader);
+  DP::DrawStats::count();
   renderTexture.display();
 
   // Draw to window
   window.draw(*sprite);
+  DP::DrawStats::count();
 }
 
 void IntroShader::reset() {
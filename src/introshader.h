@@ -17,6 +17,13 @@ public:
   IntroShader();
   ~IntroShader();
 
+  /*!
+   * \brief compileShader compiles the reveal shader (grid, else simple fallback)
+   * Called from the loading screen; initialize() compiles on demand otherwise.
+   */
+  bool compileShader();
+  sf::Shader& getShader() { return shader; }
+
   bool initialize(sf::Vector2u screenSize);
   bool initialize(sf::Vector2u screenSize, const sf::Texture* backgroundTexture);
   void setIntroTexture(const sf::Texture* introTexture);
@@ -27,7 +34,10 @@ public:
   void reset();
 
 private:
+  enum ShaderVersion { SHADER_NONE, SHADER_GRID, SHADER_SIMPLE, SHADER_FAILED };
+
   sf::Shader shader;
+  ShaderVersion shaderVersion;
   sf::RenderTexture renderTexture;
   std::unique_ptr<sf::Sprite> sprite;
   sf::Clock clock;
@@ -0,0 +1,152 @@
+#include "layer-compositor.h"
+#include <iostream>
+
+#include "draw-stats.h"
+
+namespace DP {
+
+LayerCompositor::LayerCompositor()
+  : targetSize(0, 0)
+  , baseDirty(true)
+  , compositingEnabled(true)
+  , layerRedraws(0)
+  , compositedFrames(0) {}
+
+void LayerCompositor::setLayer(Layer layer, DrawCallback callback, bool cached) {
+  LayerSlot& slot = layers[layer];
+  slot.draw = std::move(callback);
+  slot.cached = cached;
+  slot.dirty = true;
+  if (!cached) {
+    slot.cache.reset();
+  }
+  // Force target (re)creation so newly cached layers get their texture
+  targetSize = sf::Vector2u(0, 0);
+  baseDirty = true;
+}
+
+void LayerCompositor::invalidate(Layer layer) {
+  layers[layer].dirty = true;
+}
+
+void LayerCompositor::invalidateAll() {
+  for (auto& slot : layers) {
+    slot.dirty = true;
+  }
+  baseDirty = true;
+}
+
+void LayerCompositor::setEnabled(bool enabled) {
+  if (enabled != compositingEnabled) {
+    compositingEnabled = enabled;
+    invalidateAll();
+  }
+}
+
+const sf::BlendMode& LayerCompositor::premultipliedBlend() {
+  static const sf::BlendMode blend(sf::BlendMode::Factor::One,
+                                   sf::BlendMode::Factor::OneMinusSrcAlpha);
+  return blend;
+}
+
+bool LayerCompositor::ensureTargets(sf::Vector2u size) {
+  if (size == targetSize) {
+    return true;
+  }
+
+  for (auto& slot : layers) {
+    if (!slot.cached) continue;
+    if (!slot.cache) {
+      slot.cache = std::make_unique<sf::RenderTexture>();
+    }
+    if (!slot.cache->resize(size)) {
+      std::cerr << "LayerCompositor: failed to create layer target, drawing layers directly"
+                << std::endl;
+      compositingEnabled = false;
+      return false;
+    }
+    slot.cache->setSmooth(false);
+  }
+
+  if (!baseTarget.resize(size)) {
+    std::cerr << "LayerCompositor: failed to create base target, drawing layers directly"
+              << std::endl;
+    compositingEnabled = false;
+    return false;
+  }
+  baseTarget.setSmooth(false);
+
+  targetSize = size;
+  invalidateAll();
+  return true;
+}
+
+int LayerCompositor::leadingCachedCount() const {
+  int count = 0;
+  for (const auto& slot : layers) {
+    if (slot.draw && !slot.cached) break;
+    ++count;
+  }
+  return count;
+}
+
+void LayerCompositor::redrawLayer(LayerSlot& slot) {
+  slot.cache->clear(sf::Color::Transparent);
+  slot.draw(*slot.cache);
+  slot.cache->display();
+  slot.dirty = false;
+  ++layerRedraws;
+}
+
+void LayerCompositor::composite(sf::RenderTarget& target) {
+  ++compositedFrames;
+
+  if (!compositingEnabled || !ensureTargets(target.getSize())) {
+    for (auto& slot : layers) {
+      if (slot.draw) slot.draw(target);
+    }
+    return;
+  }
+
+  const int baseCount = leadingCachedCount();
+
+  // Refresh only the cached layers that received a dirty event
+  for (int i = 0; i < LAYER_COUNT; ++i) {
+    LayerSlot& slot = layers[i];
+    if (slot.draw && slot.cached && slot.dirty) {
+      redrawLayer(slot);
+      if (i < baseCount) baseDirty = true;
+    }
+  }
+
+  if (baseDirty && baseCount > 0) {
+    baseTarget.clear(sf::Color::Transparent);
+    for (int i = 0; i < baseCount; ++i) {
+      if (!layers[i].draw) continue;
+      baseTarget.draw(sf::Sprite(layers[i].cache->getTexture()), premultipliedBlend());
+      DP::DrawStats::count();
+    }
+    baseTarget.display();
+    baseDirty = false;
+  }
+
+  target.setView(target.getDefaultView());
+  if (baseCount > 0) {
+    target.draw(sf::Sprite(baseTarget.getTexture()), premultipliedBlend());
+    DP::DrawStats::count();
+  }
+
+  for (int i = baseCount; i < LAYER_COUNT; ++i) {
+    LayerSlot& slot = layers[i];
+    if (!slot.draw) continue;
+    if (slot.cached) {
+      target.setView(target.getDefaultView());
+      target.draw(sf::Sprite(slot.cache->getTexture()), premultipliedBlend());
+      DP::DrawStats::count();
+    } else {
+      slot.draw(target);
+    }
+  }
+}
+
+} // namespace DP
@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+
+namespace DP {
+
+/*!
+ * \brief LayerCompositor caches rarely changing scene layers in off-screen targets
+ *
+ * Every layer owns a draw callback. Cached layers render into their own
+ * RenderTexture only when invalidated; dynamic layers draw straight into the
+ * destination every frame. The leading run of cached layers is additionally
+ * flattened into one base target, so a steady-state frame costs a single blit
+ * plus whatever the dynamic layers draw.
+ *
+ * Cached layers are kept premultiplied (drawn with BlendAlpha onto a
+ * transparent target) and composited with One/OneMinusSrcAlpha, which keeps
+ * anti-aliased text and sprite edges identical to drawing them directly.
+ */
+class LayerCompositor {
+public:
+  enum Layer {
+    LAYER_BACKGROUND = 0,
+    LAYER_BOARD,
+    LAYER_DIAMONDS,
+    LAYER_CHARACTERS,
+    LAYER_PARTICLES,
+    LAYER_UI,
+    LAYER_COUNT
+  };
+
+  using DrawCallback = std::function<void(sf::RenderTarget&)>;
+
+  LayerCompositor();
+
+  void setLayer(Layer layer, DrawCallback callback, bool cached);
+  void invalidate(Layer layer);
+  void invalidateAll();
+  bool isDirty(Layer layer) const { return layers[layer].dirty; }
+
+  /*!
+   * \brief composite refreshes dirty cached layers and draws all layers onto target
+   * The target keeps the view of the last dynamic layer drawn.
+   */
+  void composite(sf::RenderTarget& target);
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return compositingEnabled; }
+
+  // Performance metrics
+  unsigned int getLayerRedrawCount() const { return layerRedraws; }
+  unsigned int getCompositedFrameCount() const { return compositedFrames; }
+
+private:
+  struct LayerSlot {
+    DrawCallback draw;
+    std::unique_ptr<sf::RenderTexture> cache;
+    bool cached = false;
+    bool dirty = true;
+  };
+
+  std::array<LayerSlot, LAYER_COUNT> layers;
+  sf::RenderTexture baseTarget;
+  sf::Vector2u targetSize;
+  bool baseDirty;
+  bool compositingEnabled;
+  unsigned int layerRedraws;
+  unsigned int compositedFrames;
+
+  bool ensureTargets(sf::Vector2u size);
+  void redrawLayer(LayerSlot& slot);
+  int leadingCachedCount() const;
+  static const sf::BlendMode& premultipliedBlend();
+};
+
+} // namespace DP
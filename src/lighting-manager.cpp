@@ -3,16 +3,27 @@
 #include <algorithm>
 #include <iostream>
 
+#include "draw-stats.h"
+#include "profiler.h"
+
 namespace DP {
 
 LightingManager::LightingManager() 
-  : ambientColor(20, 20, 30, 255)
+  : targetSize(0, 0)
+  , lightMapScale(LIGHTMAP_HALF)
+  , lightMapSizeDirty(true)
+  , ambientColor(20, 20, 30, 255)
   , baseLightRadius(80.0f)
   , lightingEnabled(true)
   , needsUpdate(true)
   , debugMode(false)
   , useVertexArrayBatching(true)
   , useSpatialCulling(true)
+  , autoLightMapScale(true)
+  , autoTargetFrameTime(1.0f / 60.0f)
+  , averageFrameTime(0.0f)
+  , framesSinceScaleChange(0)
+  , cullingGrid(nullptr)
   , visibleLights(0) {
   
   // Initialize vertex array for batched rendering
@@ -24,11 +35,11 @@ LightingManager::~LightingManager() {
 }
 
 bool LightingManager::initialize(sf::Vector2u windowSize) {
-  // Create render texture for light map
-  if (!lightMap.resize(windowSize)) {
+  // Create render texture for light map at the configured fraction of the target
+  targetSize = windowSize;
+  if (!resizeLightMap()) {
     return false;
   }
-  lightMap.setSmooth(true);
   
   // Create procedural light texture
   if (!createLightTexture()) {
@@ -42,6 +53,68 @@ bool LightingManager::initialize(sf::Vector2u windowSize) {
   return true;
 }
 
+bool LightingManager::resizeLightMap() {
+  sf::Vector2u mapSize(std::max(1u, targetSize.x / lightMapScale),
+                       std::max(1u, targetSize.y / lightMapScale));
+  if (!lightMap.resize(mapSize)) {
+    return false;
+  }
+  // Smoothing gives bilinear upsampling when the map is stretched over the target
+  lightMap.setSmooth(true);
+
+  // Lights stay in target coordinates; the view squeezes them into the smaller map
+  lightMap.setView(sf::View(sf::FloatRect(
+    sf::Vector2f(0, 0),
+    sf::Vector2f(static_cast<float>(targetSize.x), static_cast<float>(targetSize.y)))));
+  lightMapSizeDirty = false;
+  return true;
+}
+
+void LightingManager::setLightMapScale(LightMapScale scale) {
+  if (scale != lightMapScale) {
+    lightMapScale = scale;
+    lightMapSizeDirty = true;
+    framesSinceScaleChange = 0;
+  }
+}
+
+void LightingManager::setAutoLightMapScale(bool enabled, float targetFrameTime) {
+  autoLightMapScale = enabled;
+  autoTargetFrameTime = targetFrameTime;
+  averageFrameTime = 0.0f;
+  framesSinceScaleChange = 0;
+}
+
+/*!
+ * \brief recordFrameTime feeds the automatic light map scale selection
+ * Takes the frame's work time; a paced frame period would only measure the cap.
+ * A smoothed frame time above the target drops the light map one step; plenty
+ * of headroom raises it again. A cooldown keeps the scale from oscillating.
+ */
+void LightingManager::recordFrameTime(float seconds) {
+  if (!autoLightMapScale || seconds <= 0.0f) {
+    return;
+  }
+
+  averageFrameTime = (averageFrameTime == 0.0f) ? seconds : averageFrameTime * 0.9f + seconds * 0.1f;
+  if (++framesSinceScaleChange < AUTO_SCALE_COOLDOWN_FRAMES) {
+    return;
+  }
+
+  if (averageFrameTime > autoTargetFrameTime * 1.1f && lightMapScale != LIGHTMAP_QUARTER) {
+    setLightMapScale(lightMapScale == LIGHTMAP_FULL ? LIGHTMAP_HALF : LIGHTMAP_QUARTER);
+  } else if (averageFrameTime < autoTargetFrameTime * 0.6f && lightMapScale != LIGHTMAP_FULL) {
+    setLightMapScale(lightMapScale == LIGHTMAP_QUARTER ? LIGHTMAP_HALF : LIGHTMAP_FULL);
+  }
+
+#ifndef NDEBUG
+  if (framesSinceScaleChange == 0) {
+    std::cout << "LIGHTING: Auto light map scale 1/" << lightMapScale << " (avg frame "
+              << averageFrameTime * 1000.0f << " ms)" << std::endl;
+  }
+#endif
+}
+
 bool LightingManager::createLightTexture() {
   // Create 128x128 radial gradient texture programmatically
   const unsigned int size = 128;
@@ -118,50 +191,58 @@ void LightingManager::renderLights() {
   sf::RenderStates lightStates;
   lightStates.blendMode = sf::BlendAdd;
   
-  // Render all lights
+  // Render visible lights one sprite at a time (fallback when batching is off)
   for (const auto& light : lights) {
+    if (!light.isVisible) continue;
+
     // Scale sprite based on light radius
     float scale = (light.radius * 2.0f) / lightTexture.getSize().x;
     lightSprite->setScale(sf::Vector2f(scale, scale));
     lightSprite->setPosition(light.position);
     
     // Set light color and intensity
-    sf::Color lightColor = light.color;
-    lightColor.r = static_cast<uint8_t>(lightColor.r * light.intensity);
-    lightColor.g = static_cast<uint8_t>(lightColor.g * light.intensity);
-    lightColor.b = static_cast<uint8_t>(lightColor.b * light.intensity);
-    lightSprite->setColor(lightColor);
+    lightSprite->setColor(scaledLightColor(light));
     
     // Draw light to accumulation buffer
     lightMap.draw(*lightSprite, lightStates);
+    DP::DrawStats::count();
   }
   
   lightMap.display();
 }
 
 void LightingManager::render(sf::RenderTarget& target) {
+  DP_PROFILE_ZONE("LightingManager::render");
   if (!lightingEnabled || lights.empty()) {
+    visibleLights = 0;
     return;
   }
-  
-  // Perform spatial culling if enabled
-  if (useSpatialCulling) {
-    performSpatialCulling(lightMap.getSize());
+
+  if (lightMapSizeDirty && !resizeLightMap()) {
+    return;
   }
   
+  // Cull against the part of the light map the target's view actually shows
+  performSpatialCulling(target.getView());
+  
   // Choose rendering method based on performance settings
-  if (useVertexArrayBatching && lights.size() > 10) {
+  if (useVertexArrayBatching) {
     renderLightsBatched();
   } else {
     renderLights();
   }
   
-  // Apply light map with multiplicative blending (GEMINI25pro approach)
+  // Apply light map with multiplicative blending (GEMINI25pro approach),
+  // stretched back to target size when rendered at reduced resolution
   sf::Sprite lightMapSprite(lightMap.getTexture());
+  sf::Vector2u mapSize = lightMap.getSize();
+  lightMapSprite.setScale(sf::Vector2f(static_cast<float>(targetSize.x) / mapSize.x,
+                                       static_cast<float>(targetSize.y) / mapSize.y));
   sf::RenderStates lightMapStates;
   lightMapStates.blendMode = sf::BlendMultiply; // Multiply lights with existing scene
   
   target.draw(lightMapSprite, lightMapStates);
+  DP::DrawStats::count();
 
 #ifndef NDEBUG
   std::cout << "LIGHTING PERFORMANCE: Rendered " << visibleLights << "/" << lights.size() 
@@ -183,6 +264,7 @@ void LightingManager::renderDebugInfo(sf::RenderTarget& target) {
   for (const auto& light : lights) {
     debugCircle.setPosition(light.position);
     target.draw(debugCircle);
+    DP::DrawStats::count();
     
     // Draw light radius
     sf::CircleShape radiusCircle(light.radius);
@@ -192,6 +274,7 @@ void LightingManager::renderDebugInfo(sf::RenderTarget& target) {
     radiusCircle.setOrigin(sf::Vector2f(light.radius, light.radius));
     radiusCircle.setPosition(light.position);
     target.draw(radiusCircle);
+    DP::DrawStats::count();
   }
 }
 
@@ -201,17 +284,52 @@ void LightingManager::cleanup() {
   visibleLights = 0;
 }
 
-void LightingManager::performSpatialCulling(sf::Vector2u windowSize) {
-  // Calculate view bounds for culling (SFML 3.0.1 API)
-  viewBounds = sf::FloatRect(
-    sf::Vector2f(0, 0), 
-    sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y))
-  );
-  
+/*!
+ * \brief performSpatialCulling marks lights whose quad touches the visible area
+ * The visible area is the target view's rectangle clipped to the light map,
+ * taken from the shared culling grid when one is set. Lights span many grid
+ * cells, so they skip the cell stage and go straight to the exact test.
+ * With culling disabled every light is treated as visible.
+ */
+void LightingManager::performSpatialCulling(const sf::View& view) {
+  if (!useSpatialCulling) {
+    for (auto& light : lights) {
+      light.isVisible = true;
+    }
+    visibleLights = lights.size();
+    return;
+  }
+
+  if (cullingGrid) {
+    // The shared grid already clips the view (and its viewport) to the world
+    cullingGrid->setView(view);
+    viewBounds = cullingGrid->getVisibleBounds();
+  } else {
+    sf::Vector2f viewSize = view.getSize();
+    sf::Vector2f viewMin = view.getCenter() - viewSize / 2.0f;
+    float minX = std::max(0.0f, viewMin.x);
+    float minY = std::max(0.0f, viewMin.y);
+    float maxX = std::min(static_cast<float>(targetSize.x), viewMin.x + viewSize.x);
+    float maxY = std::min(static_cast<float>(targetSize.y), viewMin.y + viewSize.y);
+    viewBounds = sf::FloatRect(sf::Vector2f(minX, minY), sf::Vector2f(maxX - minX, maxY - minY));
+  }
+  const float minX = viewBounds.position.x;
+  const float minY = viewBounds.position.y;
+  const float maxX = minX + viewBounds.size.x;
+  const float maxY = minY + viewBounds.size.y;
+
   visibleLights = 0;
+  if (maxX <= minX || maxY <= minY) {
+    // The view shows nothing of the light map
+    for (auto& light : lights) {
+      light.isVisible = false;
+    }
+    return;
+  }
   for (auto& light : lights) {
-    // Check if light bounds intersect with view bounds
-    light.isVisible = viewBounds.findIntersection(light.bounds).has_value();
+    // Plain interval test - cheaper than findIntersection for 1000+ lights
+    light.isVisible = light.position.x + light.radius > minX && light.position.x - light.radius < maxX &&
+                      light.position.y + light.radius > minY && light.position.y - light.radius < maxY;
     if (light.isVisible) {
       visibleLights++;
     }
@@ -225,21 +343,28 @@ void LightingManager::renderLightsBatched() {
   // Build vertex array for all visible lights
   buildLightVertexArray();
   
-  // Render all lights in single draw call
+  // Render all lights in single additive draw call
   if (lightVertices.getVertexCount() > 0) {
     sf::RenderStates lightStates;
     lightStates.blendMode = sf::BlendAdd;
     lightStates.texture = &lightTexture;
     
     lightMap.draw(lightVertices, lightStates);
+    DP::DrawStats::count();
   }
   
   lightMap.display();
 }
 
+sf::Color LightingManager::scaledLightColor(const LightSource& light) {
+  float intensity = std::max(0.0f, std::min(1.0f, light.intensity));
+  return sf::Color(static_cast<uint8_t>(light.color.r * intensity),
+                   static_cast<uint8_t>(light.color.g * intensity),
+                   static_cast<uint8_t>(light.color.b * intensity), light.color.a);
+}
+
 void LightingManager::buildLightVertexArray() {
-  // Clear and reserve space for efficiency
-  lightVertices.clear();
+  // Resizing keeps the vertex storage, so steady frames do not allocate
   lightVertices.resize(visibleLights * VERTICES_PER_LIGHT);
   
   size_t vertexIndex = 0;
@@ -249,30 +374,22 @@ void LightingManager::buildLightVertexArray() {
     if (!light.isVisible) continue;
     
     // Calculate quad vertices for this light
-    float halfRadius = light.radius;
-    sf::Vector2f topLeft = light.position - sf::Vector2f(halfRadius, halfRadius);
-    sf::Vector2f bottomRight = light.position + sf::Vector2f(halfRadius, halfRadius);
-    
-    // Apply light color and intensity (SFML 3.0.1 compatible)
-    sf::Color lightColor = light.color;
-    lightColor.r = static_cast<uint8_t>(lightColor.r * light.intensity);
-    lightColor.g = static_cast<uint8_t>(lightColor.g * light.intensity);
-    lightColor.b = static_cast<uint8_t>(lightColor.b * light.intensity);
+    sf::Vector2f topLeft = light.position - sf::Vector2f(light.radius, light.radius);
+    sf::Vector2f bottomRight = light.position + sf::Vector2f(light.radius, light.radius);
+    sf::Vector2f topRight(bottomRight.x, topLeft.y);
+    sf::Vector2f bottomLeft(topLeft.x, bottomRight.y);
+    sf::Color lightColor = scaledLightColor(light);
     
-    // Create two triangles for quad using SFML 3.0.1 aggregate initialization
     // Triangle 1: top-left, top-right, bottom-left
     lightVertices[vertexIndex++] = sf::Vertex{topLeft, lightColor, sf::Vector2f(0, 0)};
-    lightVertices[vertexIndex++] = sf::Vertex{sf::Vector2f(bottomRight.x, topLeft.y), lightColor, sf::Vector2f(texSize, 0)};
-    lightVertices[vertexIndex++] = sf::Vertex{sf::Vector2f(topLeft.x, bottomRight.y), lightColor, sf::Vector2f(0, texSize)};
+    lightVertices[vertexIndex++] = sf::Vertex{topRight, lightColor, sf::Vector2f(texSize, 0)};
+    lightVertices[vertexIndex++] = sf::Vertex{bottomLeft, lightColor, sf::Vector2f(0, texSize)};
     
     // Triangle 2: top-right, bottom-right, bottom-left
-    lightVertices[vertexIndex++] = sf::Vertex{sf::Vector2f(bottomRight.x, topLeft.y), lightColor, sf::Vector2f(texSize, 0)};
+    lightVertices[vertexIndex++] = sf::Vertex{topRight, lightColor, sf::Vector2f(texSize, 0)};
     lightVertices[vertexIndex++] = sf::Vertex{bottomRight, lightColor, sf::Vector2f(texSize, texSize)};
-    lightVertices[vertexIndex++] = sf::Vertex{sf::Vector2f(topLeft.x, bottomRight.y), lightColor, sf::Vector2f(0, texSize)};
+    lightVertices[vertexIndex++] = sf::Vertex{bottomLeft, lightColor, sf::Vector2f(0, texSize)};
   }
-  
-  // Resize to actual number of vertices used
-  lightVertices.resize(vertexIndex);
 }
 
 } // namespace DP
\ No newline at end of file
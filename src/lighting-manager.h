@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
+#include "spatial-grid.h"
 
 namespace DP {
 
@@ -14,6 +15,13 @@ namespace DP {
  */
 class LightingManager {
 public:
+  /*!
+   * \brief Light map resolution as a divisor of the target size
+   * Soft radial gradients survive bilinear upsampling, so the light map can be
+   * rendered at a fraction of the target resolution to save fill rate.
+   */
+  enum LightMapScale { LIGHTMAP_FULL = 1, LIGHTMAP_HALF = 2, LIGHTMAP_QUARTER = 4 };
+
   LightingManager();
   ~LightingManager();
 
@@ -30,12 +38,20 @@ public:
   void setAmbientColor(sf::Color color) { ambientColor = color; }
   void setBaseLightRadius(float radius) { baseLightRadius = radius; }
 
+  // Light map resolution
+  void setLightMapScale(LightMapScale scale);
+  LightMapScale getLightMapScale() const { return lightMapScale; }
+  void setAutoLightMapScale(bool enabled, float targetFrameTime = 1.0f / 60.0f);
+  bool isAutoLightMapScale() const { return autoLightMapScale; }
+  void recordFrameTime(float seconds);
+
   // Performance optimization controls
   void setVertexArrayBatching(bool enabled) { useVertexArrayBatching = enabled; }
   void setSpatialCulling(bool enabled) { useSpatialCulling = enabled; }
+  void setCullingGrid(SpatialGrid* grid) { cullingGrid = grid; }
   bool isUsingBatching() const { return useVertexArrayBatching; }
   
-  // Performance metrics
+  // Performance metrics (visible count is updated by the last render() call)
   size_t getLightCount() const { return lights.size(); }
   size_t getVisibleLightCount() const { return visibleLights; }
 
@@ -46,12 +62,16 @@ public:
 private:
   // Core rendering components
   sf::RenderTexture lightMap;
+  sf::Vector2u targetSize;
+  LightMapScale lightMapScale;
+  bool lightMapSizeDirty;
   std::unique_ptr<sf::Sprite> lightSprite;
   sf::Texture lightTexture;
   
   // Performance optimization components
   sf::VertexArray lightVertices;
   sf::FloatRect viewBounds;
+  SpatialGrid* cullingGrid; // Shared broad phase, owned by Game
   size_t visibleLights;
   static constexpr size_t VERTICES_PER_LIGHT = 6; // 2 triangles for quad
   
@@ -63,6 +83,13 @@ private:
   bool debugMode;
   bool useVertexArrayBatching;
   bool useSpatialCulling;
+
+  // Automatic light map scale selection
+  bool autoLightMapScale;
+  float autoTargetFrameTime;
+  float averageFrameTime;
+  int framesSinceScaleChange;
+  static constexpr int AUTO_SCALE_COOLDOWN_FRAMES = 90;
   
   // Light data
   struct LightSource {
@@ -79,10 +106,12 @@ private:
   
   // Internal methods
   bool createLightTexture();
+  bool resizeLightMap();
   void renderLights();
   void renderLightsBatched();
-  void performSpatialCulling(sf::Vector2u windowSize);
+  void performSpatialCulling(const sf::View& view);
   void buildLightVertexArray();
+  static sf::Color scaledLightColor(const LightSource& light);
 };
 
 } // namespace DP
\ No newline at end of file
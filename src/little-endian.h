@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+
+namespace DP {
+
+// Fixed byte order for files shared between machines, e.g. assets.pak
+
+inline std::uint32_t readU32(const unsigned char* bytes) {
+  return static_cast<std::uint32_t>(bytes[0]) | static_cast<std::uint32_t>(bytes[1]) << 8 |
+         static_cast<std::uint32_t>(bytes[2]) << 16 | static_cast<std::uint32_t>(bytes[3]) << 24;
+}
+
+inline std::uint64_t readU64(const unsigned char* bytes) {
+  return static_cast<std::uint64_t>(readU32(bytes)) |
+         static_cast<std::uint64_t>(readU32(bytes + 4)) << 32;
+}
+
+inline void writeU32(std::ostream& out, std::uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out.put(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+inline void writeU64(std::ostream& out, std::uint64_t value) {
+  writeU32(out, static_cast<std::uint32_t>(value));
+  writeU32(out, static_cast<std::uint32_t>(value >> 32));
+}
+
+} // namespace DP
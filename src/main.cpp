@@ -6,12 +6,18 @@
  * This file contains the main() function that initializes and runs the game.
  */
 
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
 #include <iostream>
 #include <string>
 
 #include "error-handler.h"
 #include "exceptions.h"
 #include "game.h"
+#include "profiler.h"
+#include "startup-timer.h"
+#include "texture-cache.h"
 
 /*!
  * \brief Main entry point for the DeerPortal application
@@ -20,14 +26,60 @@
  * \return Exit code (0 for success)
  */
 int main(int argc, char* argv[]) {
+  // Startup phases are timed from here
+  DP::StartupTimer::getInstance();
   try {
-    // Check for test mode flag
+    // Parse command line flags
     bool testMode = false;
-    if (argc > 1) {
-      std::string arg(argv[1]);
+    bool startupBench = false;
+    bool framePacingSet = false;
+    DP::FramePacer::Mode framePacing = DP::FramePacer::Mode::ADAPTIVE;
+    float targetFps = 60.0f;
+    std::string startupBenchFile;
+    std::string traceFile;
+    for (int i = 1; i < argc; ++i) {
+      std::string arg(argv[i]);
       if (arg == "--test" || arg == "-t") {
         testMode = true;
         std::cout << "Running in test mode..." << std::endl;
+      } else if (arg == "--no-texture-cache") {
+        // Decode every PNG again instead of using the cached pixels
+        DP::TextureCache::getInstance().setEnabled(false);
+      } else if (arg == "--startup-bench") {
+        // Exit after the first menu frame and report the startup phases as JSON
+        startupBench = true;
+        if (i + 1 < argc && argv[i + 1][0] != '-') {
+          startupBenchFile = argv[++i];
+        }
+      } else if (arg == "--pacing" && i + 1 < argc) {
+        // --pacing vsync|cap|adaptive|unlimited [fps]
+        const std::string mode(argv[++i]);
+        if (mode == "vsync") {
+          framePacing = DP::FramePacer::Mode::VSYNC;
+        } else if (mode == "cap") {
+          framePacing = DP::FramePacer::Mode::FIXED_CAP;
+        } else if (mode == "adaptive") {
+          framePacing = DP::FramePacer::Mode::ADAPTIVE;
+        } else if (mode == "unlimited") {
+          framePacing = DP::FramePacer::Mode::UNLIMITED;
+        } else {
+          std::cerr << "--pacing: unknown mode " << mode << ", using adaptive" << std::endl;
+        }
+        framePacingSet = true;
+        if (i + 1 < argc && argv[i + 1][0] != '-') {
+          targetFps = std::strtof(argv[++i], nullptr);
+          if (targetFps <= 0.0f) {
+            std::cerr << "--pacing: invalid FPS, using 60" << std::endl;
+            targetFps = 60.0f;
+          }
+        }
+      } else if (arg == "--trace" && i + 1 < argc) {
+        // Write a Chrome trace of the buffered profiler zones on exit
+        traceFile = argv[++i];
+#ifndef DEERPORTAL_PROFILER
+        std::cerr << "--trace ignored: built without ENABLE_PROFILER" << std::endl;
+        traceFile.clear();
+#endif
       }
     }
 
@@ -40,9 +92,33 @@ int main(int argc, char* argv[]) {
           }
         });
 
+    // The only place std::rand is seeded; deerportal-renderbench fixes it instead
+    std::srand(static_cast<unsigned>(std::time(nullptr)));
+
     // Create and run the game
     DP::Game game(testMode);
-    return game.run();
+    if (framePacingSet) {
+      game.setFramePacing(framePacing, targetFps);
+    }
+    int exitCode = 0;
+    if (startupBench) {
+      game.presentFirstMenuFrame();
+      game.closeWindow();
+      if (startupBenchFile.empty()) {
+        DP::StartupTimer::getInstance().writeJson(std::cout);
+      } else {
+        std::ofstream out(startupBenchFile);
+        DP::StartupTimer::getInstance().writeJson(out);
+      }
+    } else {
+      exitCode = game.run();
+    }
+#ifdef DEERPORTAL_PROFILER
+    if (!traceFile.empty()) {
+      DP::Profiler::getInstance().exportChromeTrace(traceFile);
+    }
+#endif
+    return exitCode;
   } catch (const DeerPortal::AssetLoadException& e) {
     std::cerr << "Critical Asset Error: " << e.what() << std::endl;
     std::cerr << "Failed to load: " << e.getFilename() << std::endl;
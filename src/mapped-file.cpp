@@ -0,0 +1,119 @@
+#include "mapped-file.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace DP {
+
+MappedFile::MappedFile()
+  : mapping(nullptr)
+  , mappingSize(0)
+#ifdef _WIN32
+  , fileHandle(nullptr)
+  , mappingHandle(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept : MappedFile() {
+  *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    close();
+    std::swap(mapping, other.mapping);
+    std::swap(mappingSize, other.mappingSize);
+#ifdef _WIN32
+    std::swap(fileHandle, other.fileHandle);
+    std::swap(mappingHandle, other.mappingHandle);
+#endif
+  }
+  return *this;
+}
+
+bool MappedFile::open(const std::string& path) {
+  close();
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (view == nullptr) {
+    CloseHandle(file);
+    return false;
+  }
+  void* data = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+  if (data == nullptr) {
+    CloseHandle(view);
+    CloseHandle(file);
+    return false;
+  }
+  fileHandle = file;
+  mappingHandle = view;
+  mapping = static_cast<const unsigned char*>(data);
+  mappingSize = static_cast<std::size_t>(size.QuadPart);
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // The mapping keeps the file alive
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  mapping = static_cast<const unsigned char*>(data);
+  mappingSize = static_cast<std::size_t>(st.st_size);
+#endif
+  return true;
+}
+
+void MappedFile::close() {
+  if (mapping == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(mapping);
+  CloseHandle(static_cast<HANDLE>(mappingHandle));
+  CloseHandle(static_cast<HANDLE>(fileHandle));
+  mappingHandle = nullptr;
+  fileHandle = nullptr;
+#else
+  munmap(const_cast<unsigned char*>(mapping), mappingSize);
+#endif
+  mapping = nullptr;
+  mappingSize = 0;
+}
+
+} // namespace DP
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace DP {
+
+/*!
+ * \brief MappedFile is a read-only memory mapping of a whole file
+ *
+ * mmap on POSIX, MapViewOfFile on Windows. Pages are faulted in on access,
+ * so opening is cheap and untouched parts of the file are never read.
+ */
+class MappedFile {
+public:
+  MappedFile();
+  ~MappedFile();
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Fails for missing and empty files
+  bool open(const std::string& path);
+  void close();
+
+  bool isOpen() const { return mapping != nullptr; }
+  const unsigned char* data() const { return mapping; }
+  std::size_t size() const { return mappingSize; }
+
+private:
+  const unsigned char* mapping;
+  std::size_t mappingSize;
+#ifdef _WIN32
+  void* fileHandle;
+  void* mappingHandle;
+#endif
+};
+
+} // namespace DP
@@ -0,0 +1,262 @@
+#include "music-controller.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+#include "asset-archive.h"
+#include "error-handler.h"
+#include "profiler.h"
+
+namespace DP {
+
+namespace {
+
+const float HALF_PI = 1.57079632679f;
+
+float shape(MusicController::Curve curve, float t) {
+  switch (curve) {
+  case MusicController::Curve::EQUAL_POWER:
+    return std::sin(t * HALF_PI);
+  case MusicController::Curve::S_CURVE:
+    return t * t * (3.0f - 2.0f * t);
+  case MusicController::Curve::LINEAR:
+  default:
+    return t;
+  }
+}
+
+} // namespace
+
+float MusicController::Fade::gainAt(std::int64_t time) const {
+  if (length <= 0) {
+    return to;
+  }
+  const float t =
+      std::clamp(static_cast<float>(time - start) / static_cast<float>(length), 0.0f, 1.0f);
+  // Mirrored for fade-outs, so an equal power crossfade keeps the sum of powers
+  if (to >= from) {
+    return from + (to - from) * shape(curve, t);
+  }
+  return to + (from - to) * shape(curve, 1.0f - t);
+}
+
+MusicController::Track::~Track() {
+  if (opener.joinable()) opener.join();
+}
+
+MusicController::Fade MusicController::Track::readFade() const {
+  for (;;) {
+    const unsigned int sequence = fadeSequence.load(std::memory_order_acquire);
+    if (sequence & 1u) {
+      continue;
+    }
+    const Fade fade{fadeFrom.load(std::memory_order_relaxed),
+                    fadeTo.load(std::memory_order_relaxed),
+                    fadeStart.load(std::memory_order_relaxed),
+                    fadeLength.load(std::memory_order_relaxed),
+                    static_cast<Curve>(fadeCurve.load(std::memory_order_relaxed))};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (fadeSequence.load(std::memory_order_relaxed) == sequence) {
+      return fade;
+    }
+  }
+}
+
+void MusicController::Track::writeFade(const Fade& fade) {
+  const unsigned int sequence = fadeSequence.load(std::memory_order_relaxed);
+  fadeSequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  fadeFrom.store(fade.from, std::memory_order_relaxed);
+  fadeTo.store(fade.to, std::memory_order_relaxed);
+  fadeStart.store(fade.start, std::memory_order_relaxed);
+  fadeLength.store(fade.length, std::memory_order_relaxed);
+  fadeCurve.store(static_cast<int>(fade.curve), std::memory_order_relaxed);
+  fadeSequence.store(sequence + 2, std::memory_order_release);
+}
+
+void MusicController::Track::process(const float* inputFrames, unsigned int& inputFrameCount,
+                                     float* outputFrames, unsigned int& outputFrameCount,
+                                     unsigned int frameChannelCount) {
+  // Audio thread. Ramps from the gain of the last chunk, so there are no steps
+  const unsigned int frameCount = std::min(inputFrameCount, outputFrameCount);
+  const float startGain = appliedGain.load(std::memory_order_relaxed);
+  const float endGain = readFade().gainAt(MusicController::now());
+  for (unsigned int frame = 0; frame < frameCount; ++frame) {
+    const float gain =
+        startGain + (endGain - startGain) * static_cast<float>(frame + 1) / frameCount;
+    for (unsigned int channel = 0; channel < frameChannelCount; ++channel) {
+      const std::size_t sample = std::size_t{frame} * frameChannelCount + channel;
+      outputFrames[sample] = inputFrames ? inputFrames[sample] * gain : 0.0f;
+    }
+  }
+  appliedGain.store(endGain, std::memory_order_relaxed);
+  inputFrameCount = frameCount;
+  outputFrameCount = frameCount;
+}
+
+MusicController::MusicController()
+  : fadeLength(std::chrono::nanoseconds(std::chrono::milliseconds(1500)).count())
+  , fadeCurve(Curve::EQUAL_POWER) {}
+
+void MusicController::addTrack(const std::string& name, const std::string& file,
+                               std::set<int> prefetchStates) {
+  std::unique_ptr<Track> track = std::make_unique<Track>();
+  track->name = name;
+  track->file = file;
+  track->prefetch = std::move(prefetchStates);
+  tracks.push_back(std::move(track));
+}
+
+void MusicController::setCrossfade(sf::Time length, Curve curve) {
+  fadeLength = std::max<std::int64_t>(0, length.asMicroseconds()) * 1000;
+  fadeCurve = curve;
+}
+
+void MusicController::setState(int state) {
+  for (const std::unique_ptr<Track>& track : tracks) {
+    if (track->prefetch.count(state) > 0) {
+      startOpening(*track);
+    }
+  }
+}
+
+void MusicController::prefetch(const std::string& name) {
+  if (Track* track = find(name)) {
+    startOpening(*track);
+  }
+}
+
+void MusicController::play(const std::string& name) {
+  for (const std::unique_ptr<Track>& track : tracks) {
+    if (track->name != name) {
+      track->wanted = false;
+      if (track->started) fadeTo(*track, 0.0f);
+      continue;
+    }
+    track->wanted = true;
+    startOpening(*track);
+    if (track->ready) {
+      fadeTo(*track, 1.0f);
+    }
+  }
+}
+
+void MusicController::stop(const std::string& name) {
+  Track* track = find(name);
+  if (!track) {
+    return;
+  }
+  track->wanted = false;
+  if (track->started) {
+    fadeTo(*track, 0.0f);
+  }
+}
+
+void MusicController::update() {
+  DP_PROFILE_ZONE("MusicController::update");
+  const std::int64_t time = now();
+  for (const std::unique_ptr<Track>& track : tracks) {
+    if (!track->ready) {
+      const Open state = track->open.load(std::memory_order_acquire);
+      if (state != Open::OPEN && state != Open::FAILED) {
+        continue;
+      }
+      finishOpening(*track);
+      if (track->ready && track->wanted) {
+        fadeTo(*track, 1.0f);
+      }
+      continue;
+    }
+    // Stopped only once silent, which also rewinds it for the next play
+    if (track->started && !track->wanted && track->readFade().isDone(time)) {
+      track->music.stop();
+      track->started = false;
+    }
+  }
+}
+
+bool MusicController::isPlaying(const std::string& name) const {
+  const Track* track = find(name);
+  return track && track->started && track->wanted;
+}
+
+MusicController::Track* MusicController::find(const std::string& name) const {
+  for (const std::unique_ptr<Track>& track : tracks) {
+    if (track->name == name) {
+      return track.get();
+    }
+  }
+  return nullptr;
+}
+
+void MusicController::startOpening(Track& track) {
+  if (track.open.load(std::memory_order_relaxed) != Open::CLOSED) {
+    return;
+  }
+#ifndef NDEBUG
+  std::cout << "MusicController: opening " << track.file << std::endl;
+#endif
+  track.open.store(Open::OPENING, std::memory_order_relaxed);
+  auto openStream = [&track]() {
+    DP_PROFILE_THREAD("Music opener");
+    const bool opened = openAsset(track.music, track.file);
+    track.open.store(opened ? Open::OPEN : Open::FAILED, std::memory_order_release);
+  };
+  try {
+    track.opener = std::thread(openStream);
+  } catch (const std::system_error& e) {
+    std::cerr << "MusicController: cannot start opener thread: " << e.what() << std::endl;
+    openStream();
+  }
+}
+
+void MusicController::finishOpening(Track& track) {
+  if (track.opener.joinable()) track.opener.join();
+  if (track.open.load(std::memory_order_acquire) == Open::FAILED) {
+    DeerPortal::ErrorHandler::getInstance().logError(
+        DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, track.file,
+                                       "Failed to load music - audio disabled"));
+    // Failed tracks stay silent; ready only stops the checks
+    track.ready = true;
+    track.wanted = false;
+    return;
+  }
+  track.music.setLooping(true);
+  track.music.setEffectProcessor(
+      [&track](const float* inputFrames, unsigned int& inputFrameCount, float* outputFrames,
+               unsigned int& outputFrameCount, unsigned int frameChannelCount) {
+        track.process(inputFrames, inputFrameCount, outputFrames, outputFrameCount,
+                      frameChannelCount);
+      });
+  track.ready = true;
+}
+
+void MusicController::fadeTo(Track& track, float gain) {
+  if (track.open.load(std::memory_order_relaxed) != Open::OPEN) {
+    return;
+  }
+  const std::int64_t time = now();
+  const Fade current = track.readFade();
+  if (track.started && current.to == gain) {
+    return; // Already heading there
+  }
+  const float from = track.started ? current.gainAt(time) : 0.0f;
+  track.writeFade({from, gain, time, fadeLength, fadeCurve});
+  if (!track.started) {
+    track.appliedGain.store(0.0f, std::memory_order_relaxed);
+    track.music.play();
+    track.started = true;
+  }
+}
+
+std::int64_t MusicController::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+} // namespace DP
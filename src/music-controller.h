@@ -0,0 +1,120 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+
+namespace DP {
+
+/*!
+ * \brief MusicController opens music streams ahead of time and crossfades them
+ *
+ * Opening a stream reads and parses the file, so tracks are opened on a
+ * background thread in the states that lead to them. play() and stop() never
+ * wait for that: a track asked for while still opening starts from update()
+ * once it is ready.
+ *
+ * Fades run on the audio thread. Each track's effect processor scales the
+ * samples along the current fade curve, so a slow frame does not make the
+ * fade jump. The main thread only publishes a new fade and stops tracks that
+ * have faded out.
+ *
+ * States are plain ints, as in AssetStreamer.
+ */
+class MusicController {
+public:
+  enum class Curve { LINEAR, EQUAL_POWER, S_CURVE };
+
+  MusicController();
+
+  MusicController(const MusicController&) = delete;
+  MusicController& operator=(const MusicController&) = delete;
+
+  /*!
+   * \brief addTrack registers a looping track
+   * \param file Path relative to the assets directory, e.g. "audio/menu.ogg"
+   * \param prefetchStates States in which the stream is opened in the background
+   */
+  void addTrack(const std::string& name, const std::string& file, std::set<int> prefetchStates);
+
+  // Applies to fades started after the call
+  void setCrossfade(sf::Time length, Curve curve);
+
+  // Starts opening the tracks the state may lead to
+  void setState(int state);
+
+  // Starts opening a track; does nothing if it is already open
+  void prefetch(const std::string& name);
+
+  // Fades the track in and every other track out
+  void play(const std::string& name);
+
+  void stop(const std::string& name);
+
+  // Main thread, once per frame; starts opened tracks and stops silent ones
+  void update();
+
+  bool isPlaying(const std::string& name) const;
+
+private:
+  enum class Open { CLOSED, OPENING, OPEN, FAILED };
+
+  struct Fade {
+    float from;
+    float to;
+    std::int64_t start; // Nanoseconds on the steady clock
+    std::int64_t length;
+    Curve curve;
+
+    float gainAt(std::int64_t time) const;
+    bool isDone(std::int64_t time) const { return time - start >= length; }
+  };
+
+  struct Track {
+    std::string name;
+    std::string file;
+    std::set<int> prefetch;
+
+    // Written by the main thread, read by the audio thread; fadeSequence is
+    // odd while a fade is being written
+    std::atomic<unsigned int> fadeSequence{0};
+    std::atomic<float> fadeFrom{0.0f};
+    std::atomic<float> fadeTo{0.0f};
+    std::atomic<std::int64_t> fadeStart{0};
+    std::atomic<std::int64_t> fadeLength{0};
+    std::atomic<int> fadeCurve{0};
+    std::atomic<float> appliedGain{0.0f}; // Gain at the end of the last chunk
+
+    std::atomic<Open> open{Open::CLOSED};
+    std::thread opener;
+    bool ready = false;   // Opened and set up on the main thread
+    bool wanted = false;  // Should be audible
+    bool started = false; // play() was called on the stream
+
+    // Last, so the stream stops before the fade it reads is destroyed
+    sf::Music music;
+
+    ~Track(); // Waits for the stream to finish opening
+    Fade readFade() const;
+    void writeFade(const Fade& fade);
+    void process(const float* inputFrames, unsigned int& inputFrameCount, float* outputFrames,
+                 unsigned int& outputFrameCount, unsigned int frameChannelCount);
+  };
+
+  std::vector<std::unique_ptr<Track>> tracks;
+  std::int64_t fadeLength;
+  Curve fadeCurve;
+
+  Track* find(const std::string& name) const;
+  void startOpening(Track& track);
+  void finishOpening(Track& track);
+  void fadeTo(Track& track, float gain);
+  static std::int64_t now();
+};
+
+} // namespace DP
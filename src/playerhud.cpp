@@ -4,6 +4,7 @@
 #include <string>
 
 #include "boardelem.h"
+#include "draw-stats.h"
 #include "textureholder.h"
 
 std::set<int> Player::getTerrainSet() {
@@ -140,7 +141,10 @@ std::string Player::getElem(sf::Vector2f mousePosition) {
 
 void Player::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   states.transform *= getTransform();
-  if (txtCash) target.draw(*txtCash, states);
+  if (txtCash) {
+    target.draw(*txtCash, states);
+    DP::DrawStats::count();
+  }
   // if (txtEnergy) target.draw(*txtEnergy, states);  // REMOVED - Not drawn in 0.8.2
   // if (txtFood) target.draw(*txtFood, states);      // REMOVED - Not drawn in 0.8.2
   // if (txtFaith) target.draw(*txtFaith, states);    // REMOVED - Not drawn in 0.8.2
@@ -54,9 +54,7 @@ public:
 
   bool human;
 
-  sf::Texture textureAI;
-  std::unique_ptr<sf::Sprite> spriteAI;
-  sf::Texture textureCountries[4];
+  std::unique_ptr<sf::Sprite> spriteAI; // Button textures live in TextureHolder
   std::map<sf::Keyboard::Key, sf::RectangleShape> elemKeys;
 
   /*
@@ -75,7 +73,6 @@ public:
 
   bool aiActive;
   std::unique_ptr<sf::Sprite> symbol;
-  sf::Texture symbolTexture;
 
   int tileSize;
   TextureHolder* textures;
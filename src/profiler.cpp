@@ -0,0 +1,228 @@
+#include "profiler.h"
+
+#ifdef DEERPORTAL_PROFILER
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace DP {
+
+thread_local std::uint32_t ProfileZone::depth = 0;
+
+namespace {
+thread_local void* currentThreadBuffer = nullptr;
+
+sf::Color zoneColor(const char* name) {
+  // Stable colour per zone name (FNV-1a), kept in a warm, readable range
+  std::uint32_t hash = 2166136261u;
+  for (const char* c = name; *c; ++c) {
+    hash = (hash ^ static_cast<std::uint8_t>(*c)) * 16777619u;
+  }
+  return sf::Color(static_cast<std::uint8_t>(140 + (hash & 0x7F)),
+                   static_cast<std::uint8_t>(80 + ((hash >> 8) & 0x7F)),
+                   static_cast<std::uint8_t>(40 + ((hash >> 16) & 0x5F)), 220);
+}
+
+void writeJsonString(std::ostream& out, const std::string& text) {
+  out << '"';
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << ' ';
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+} // namespace
+
+Profiler& Profiler::getInstance() {
+  static Profiler instance;
+  return instance;
+}
+
+Profiler::Profiler()
+  : epoch(std::chrono::steady_clock::now())
+  , frameThread(nullptr)
+  , frameStartNs(0)
+  , lastFrameStartNs(0)
+  , lastFrameEndNs(0)
+  , flameBarVisible(false) {}
+
+std::uint64_t Profiler::now() const {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch)
+          .count());
+}
+
+Profiler::ThreadBuffer& Profiler::threadBuffer() {
+  if (currentThreadBuffer) {
+    return *static_cast<ThreadBuffer*>(currentThreadBuffer);
+  }
+
+  // First zone on this thread. Buffers are never freed, so samples of
+  // finished threads remain exportable.
+  auto buffer = std::make_unique<ThreadBuffer>();
+  buffer->events.resize(EVENTS_PER_THREAD);
+
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  buffer->id = static_cast<std::uint32_t>(buffers.size());
+  buffer->name = "Thread " + std::to_string(buffer->id);
+  currentThreadBuffer = buffer.get();
+  buffers.push_back(std::move(buffer));
+  return *buffers.back();
+}
+
+void Profiler::record(const char* name, std::uint64_t startNs, std::uint64_t endNs,
+                      std::uint32_t depth) {
+  ThreadBuffer& buffer = threadBuffer();
+  const std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+  buffer.events[index % EVENTS_PER_THREAD] = ProfileEvent{name, startNs, endNs, depth};
+  buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const std::string& name) {
+  ThreadBuffer& buffer = threadBuffer();
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  buffer.name = name;
+}
+
+void Profiler::frameMark() {
+  const std::uint64_t timestamp = now();
+  frameThread = &threadBuffer();
+  if (frameStartNs != 0) {
+    lastFrameStartNs = frameStartNs;
+    lastFrameEndNs = timestamp;
+  }
+  frameStartNs = timestamp;
+}
+
+bool Profiler::exportChromeTrace(const std::string& path) const {
+  std::ofstream out(path);
+  if (!out) {
+    std::cerr << "Profiler: cannot write trace to " << path << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  std::size_t eventCount = 0;
+  char number[64];
+
+  out << "{\"traceEvents\":[\n";
+  bool first = true;
+  for (const auto& buffer : buffers) {
+    out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+        << buffer->id << ",\"args\":{\"name\":";
+    writeJsonString(out, buffer->name);
+    out << "}}";
+    first = false;
+
+    // Samples still in the ring, oldest first. Slots being written by a live
+    // thread at this moment may be stale; that is acceptable for a dev tool.
+    const std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+    const std::uint64_t available = std::min<std::uint64_t>(written, EVENTS_PER_THREAD);
+    for (std::uint64_t i = written - available; i < written; ++i) {
+      const ProfileEvent& event = buffer->events[i % EVENTS_PER_THREAD];
+      out << ",\n{\"name\":";
+      writeJsonString(out, event.name);
+      std::snprintf(number, sizeof(number), "%.3f", event.startNs / 1000.0);
+      out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id << ",\"ts\":" << number;
+      std::snprintf(number, sizeof(number), "%.3f", (event.endNs - event.startNs) / 1000.0);
+      out << ",\"dur\":" << number << "}";
+      ++eventCount;
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  if (!out) {
+    std::cerr << "Profiler: failed while writing " << path << std::endl;
+    return false;
+  }
+  std::cout << "Profiler: wrote " << eventCount << " zones to " << path << std::endl;
+  return true;
+}
+
+void Profiler::drawFlameBar(sf::RenderTarget& target, const sf::Font& font, float budgetMs) {
+  if (!flameBarVisible || !frameThread || lastFrameEndNs <= lastFrameStartNs) {
+    return;
+  }
+
+  const float rowHeight = 14.0f;
+  const sf::Vector2f viewSize = target.getView().getSize();
+  const sf::Vector2f viewOrigin = target.getView().getCenter() - viewSize / 2.0f;
+  const double frameNs = static_cast<double>(lastFrameEndNs - lastFrameStartNs);
+  // Full width is the budget; a frame over budget is squeezed to fit
+  const double spanNs = std::max(frameNs, budgetMs * 1.0e6);
+  const double nsToPixels = viewSize.x / spanNs;
+  const float bottom = viewOrigin.y + viewSize.y;
+
+  flameVertices.clear();
+  std::vector<const ProfileEvent*> labelled;
+
+  // Newest first; stop once zones end before the frame began
+  const std::uint64_t written = frameThread->written.load(std::memory_order_acquire);
+  const std::uint64_t available = std::min<std::uint64_t>(written, EVENTS_PER_THREAD);
+  for (std::uint64_t n = 0; n < available; ++n) {
+    const ProfileEvent& event = frameThread->events[(written - 1 - n) % EVENTS_PER_THREAD];
+    if (event.endNs < lastFrameStartNs) break;
+    if (event.startNs < lastFrameStartNs || event.endNs > lastFrameEndNs) continue;
+
+    const float left = viewOrigin.x + static_cast<float>((event.startNs - lastFrameStartNs) * nsToPixels);
+    const float right =
+        viewOrigin.x + static_cast<float>((event.endNs - lastFrameStartNs) * nsToPixels);
+    const float top = bottom - rowHeight * (event.depth + 1);
+    const float lower = top + rowHeight - 1.0f;
+    const float width = std::max(1.0f, right - left);
+    const sf::Color color = zoneColor(event.name);
+
+    flameVertices.push_back(sf::Vertex{{left, top}, color});
+    flameVertices.push_back(sf::Vertex{{left + width, top}, color});
+    flameVertices.push_back(sf::Vertex{{left + width, lower}, color});
+    flameVertices.push_back(sf::Vertex{{left, top}, color});
+    flameVertices.push_back(sf::Vertex{{left + width, lower}, color});
+    flameVertices.push_back(sf::Vertex{{left, lower}, color});
+
+    if (width > 60.0f) {
+      labelled.push_back(&event);
+    }
+  }
+
+  // Budget marker
+  const float budgetX = viewOrigin.x + static_cast<float>(budgetMs * 1.0e6 * nsToPixels);
+  const sf::Color markerColor(255, 60, 60);
+  flameVertices.push_back(sf::Vertex{{budgetX - 1.0f, bottom - rowHeight * 8}, markerColor});
+  flameVertices.push_back(sf::Vertex{{budgetX + 1.0f, bottom - rowHeight * 8}, markerColor});
+  flameVertices.push_back(sf::Vertex{{budgetX + 1.0f, bottom}, markerColor});
+  flameVertices.push_back(sf::Vertex{{budgetX - 1.0f, bottom - rowHeight * 8}, markerColor});
+  flameVertices.push_back(sf::Vertex{{budgetX + 1.0f, bottom}, markerColor});
+  flameVertices.push_back(sf::Vertex{{budgetX - 1.0f, bottom}, markerColor});
+
+  target.draw(flameVertices.data(), flameVertices.size(), sf::PrimitiveType::Triangles);
+
+  sf::Text label(font, "", 10);
+  label.setFillColor(sf::Color::Black);
+  char text[96];
+  for (const ProfileEvent* event : labelled) {
+    std::snprintf(text, sizeof(text), "%s %.2f ms", event->name,
+                  (event->endNs - event->startNs) / 1.0e6);
+    label.setString(text);
+    label.setPosition(sf::Vector2f(
+        viewOrigin.x + static_cast<float>((event->startNs - lastFrameStartNs) * nsToPixels) + 2.0f,
+        bottom - rowHeight * (event->depth + 1)));
+    target.draw(label);
+  }
+
+  std::snprintf(text, sizeof(text), "Frame %.2f ms", frameNs / 1.0e6);
+  label.setString(text);
+  label.setFillColor(sf::Color::White);
+  label.setPosition(sf::Vector2f(viewOrigin.x + 2.0f, bottom - rowHeight * 9));
+  target.draw(label);
+}
+
+} // namespace DP
+
+#endif // DEERPORTAL_PROFILER
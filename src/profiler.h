@@ -0,0 +1,149 @@
+#pragma once
+
+/*!
+ * \file profiler.h
+ * \brief Scoped profiling zones with Chrome trace export
+ *
+ * Zones are only compiled in when the build defines DEERPORTAL_PROFILER
+ * (cmake -DENABLE_PROFILER=ON). Otherwise every DP_PROFILE_* macro expands to
+ * nothing and this header pulls in no dependencies.
+ *
+ * Usage:
+ *   void GameCore::update(...) {
+ *     DP_PROFILE_ZONE("GameCore::update");
+ *     ...
+ *   }
+ */
+
+#ifdef DEERPORTAL_PROFILER
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+namespace DP {
+
+struct ProfileEvent {
+  const char* name; // Must have static storage (string literal or __func__)
+  std::uint64_t startNs;
+  std::uint64_t endNs;
+  std::uint32_t depth;
+};
+
+/*!
+ * \brief Profiler collects zone samples into per-thread ring buffers
+ *
+ * Each thread writes only to its own buffer, so recording a zone is two clock
+ * reads and a store with no locking. The mutex is only taken when a thread
+ * records its first zone and when exporting.
+ */
+class Profiler {
+public:
+  static constexpr std::size_t EVENTS_PER_THREAD = 65536;
+
+  static Profiler& getInstance();
+
+  // Monotonic time in nanoseconds since the profiler was created
+  std::uint64_t now() const;
+
+  void record(const char* name, std::uint64_t startNs, std::uint64_t endNs, std::uint32_t depth);
+
+  // Label the calling thread in exported traces
+  void setThreadName(const std::string& name);
+
+  /*!
+   * \brief frameMark closes the current frame on the calling thread
+   * The flame bar shows the zones of the last closed frame.
+   */
+  void frameMark();
+
+  /*!
+   * \brief exportChromeTrace writes all buffered zones as Chrome trace JSON
+   * Open the file in chrome://tracing or https://ui.perfetto.dev
+   * \return true if the file was written
+   */
+  bool exportChromeTrace(const std::string& path) const;
+
+  void toggleFlameBar() { flameBarVisible = !flameBarVisible; }
+  bool isFlameBarVisible() const { return flameBarVisible; }
+
+  /*!
+   * \brief drawFlameBar draws the last frame's zones along the bottom of the target
+   * \param budgetMs Frame budget mapped to the full target width
+   */
+  void drawFlameBar(sf::RenderTarget& target, const sf::Font& font, float budgetMs = 16.667f);
+
+private:
+  struct ThreadBuffer {
+    std::uint32_t id = 0;
+    std::string name;
+    std::vector<ProfileEvent> events;
+    std::atomic<std::uint64_t> written{0};
+  };
+
+  Profiler();
+  ThreadBuffer& threadBuffer();
+
+  const std::chrono::steady_clock::time_point epoch;
+  mutable std::mutex buffersMutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+  // Frame window for the flame bar, owned by the thread calling frameMark
+  ThreadBuffer* frameThread;
+  std::uint64_t frameStartNs;
+  std::uint64_t lastFrameStartNs;
+  std::uint64_t lastFrameEndNs;
+
+  bool flameBarVisible;
+  std::vector<sf::Vertex> flameVertices;
+};
+
+/*!
+ * \brief ProfileZone records the lifetime of a scope
+ */
+class ProfileZone {
+public:
+  explicit ProfileZone(const char* zoneName)
+    : name(zoneName)
+    , startNs(Profiler::getInstance().now()) {
+    ++depth;
+  }
+
+  ~ProfileZone() {
+    --depth;
+    Profiler::getInstance().record(name, startNs, Profiler::getInstance().now(), depth);
+  }
+
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+  static thread_local std::uint32_t depth;
+
+  const char* name;
+  std::uint64_t startNs;
+};
+
+} // namespace DP
+
+#define DP_PROFILE_CONCAT_INNER(a, b) a##b
+#define DP_PROFILE_CONCAT(a, b) DP_PROFILE_CONCAT_INNER(a, b)
+#define DP_PROFILE_ZONE(name) DP::ProfileZone DP_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define DP_PROFILE_FUNCTION() DP_PROFILE_ZONE(__func__)
+#define DP_PROFILE_FRAME() DP::Profiler::getInstance().frameMark()
+#define DP_PROFILE_THREAD(name) DP::Profiler::getInstance().setThreadName(name)
+
+#else
+
+#define DP_PROFILE_ZONE(name) ((void)0)
+#define DP_PROFILE_FUNCTION() ((void)0)
+#define DP_PROFILE_FRAME() ((void)0)
+#define DP_PROFILE_THREAD(name) ((void)0)
+
+#endif // DEERPORTAL_PROFILER
@@ -0,0 +1,270 @@
+/*!
+ * \file render-bench.cpp
+ * \brief Entry point of deerportal-renderbench, the scripted rendering benchmark
+ *
+ * Builds each game state from a fixed script (full board, particle bursts,
+ * lights, card notification, end-game screen), renders a fixed number of
+ * frames into the off-screen scene texture and reports frame time
+ * percentiles and draw counts as JSON.
+ *
+ * Usage: deerportal-renderbench [--frames N] [--warmup N] [--output FILE]
+ *
+ * On a machine without a GPU run it under a virtual display with Mesa's
+ * software rasterizer, see scripts/renderbench.sh.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include "draw-stats.h"
+#include "game.h"
+
+namespace DP {
+
+struct BenchResult {
+  std::string name;
+  int frames = 0;
+  double meanMs = 0.0;
+  double p50Ms = 0.0;
+  double p95Ms = 0.0;
+  double p99Ms = 0.0;
+  double maxMs = 0.0;
+  double drawCallsPerFrame = 0.0;
+  unsigned int bursts = 0;           // Particle bursts requested while measuring
+  unsigned int throttledBursts = 0;  // Of those, cut short by the particle budget
+  unsigned int droppedParticles = 0; // Particles the budget did not emit
+};
+
+/*!
+ * \brief RenderBench drives Game through scripted states without the main loop
+ */
+class RenderBench {
+public:
+  RenderBench(Game& benchGame, int benchFrames, int benchWarmupFrames)
+    : game(benchGame)
+    , frames(benchFrames)
+    , warmupFrames(benchWarmupFrames) {}
+
+  std::vector<BenchResult> runAll() {
+    std::vector<BenchResult> results;
+    results.push_back(run("menu", Game::state_menu, &RenderBench::setupMenu));
+    results.push_back(run("setup_players", Game::state_setup_players, &RenderBench::setupBoard));
+    results.push_back(
+        run("board_animation", Game::state_board_animation, &RenderBench::setupBoardAnimation));
+    results.push_back(run("lets_begin", Game::state_lets_begin, &RenderBench::setupLetsBegin));
+    results.push_back(run("game", Game::state_game, &RenderBench::setupGameplay));
+    results.push_back(
+        run("gui_end_round", Game::state_gui_end_round, &RenderBench::setupEndRound));
+    results.push_back(run("end_game", Game::state_end_game, &RenderBench::setupEndGame));
+    return results;
+  }
+
+  std::string getRendererName() {
+    (void)game.renderTexture.setActive(true);
+    const GLubyte* renderer = glGetString(GL_RENDERER);
+    return renderer ? reinterpret_cast<const char*>(renderer) : "unknown";
+  }
+
+private:
+  using Setup = void (RenderBench::*)();
+  static constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+  Game& game;
+  int frames;
+  int warmupFrames;
+  bool spawnBursts = false;
+
+  void setupMenu() { game.stateManager->showMenu(); }
+
+  void setupBoard() { game.stateManager->showGameBoard(); }
+
+  void setupBoardAnimation() {
+    setupBoard();
+    game.stateManager->transitionToBoardAnimation();
+  }
+
+  void setupLetsBegin() { game.stateManager->transitionToLetsBegin(); }
+
+  void setupGameplay() {
+    game.stateManager->transitionToRollDice();
+    game.currentState = Game::state_game;
+    game.cardNotification.showCardNotification("diamond", 0, -1, 0);
+    spawnBursts = true;
+  }
+
+  void setupEndRound() {
+    game.guiRoundDice.active = true;
+    game.guiRoundDice.setTitle("Bench round");
+    game.currentState = Game::state_gui_end_round;
+  }
+
+  void setupEndGame() { game.stateManager->endGame(); }
+
+  void scriptFrame(int frame) {
+    if (!spawnBursts) return;
+
+    // A burst every few frames somewhere on the board keeps the particle
+    // pool busy; the notification is re-shown when it times out.
+    if (frame % 6 == 0) {
+      const float x = 200.0f + static_cast<float>((frame * 97) % 900);
+      const float y = 100.0f + static_cast<float>((frame * 61) % 550);
+      game.getAnimationSystem()->createDiamondCollectionBurst(sf::Vector2f(x, y));
+    }
+    if (!game.cardNotification.isActive()) {
+      game.cardNotification.showCardNotification("card", frame % 4, (frame + 1) % 4, frame % 4);
+    }
+  }
+
+  BenchResult run(const char* name, Game::states state, Setup setup) {
+    spawnBursts = false;
+    (this->*setup)();
+    game.assetStreamer.setState(state);
+
+    std::vector<double> times;
+    times.reserve(frames);
+    std::size_t drawCalls = 0;
+
+    for (int frame = 0; frame < warmupFrames + frames; ++frame) {
+      if (frame == warmupFrames) {
+        game.getAnimationSystem()->resetParticleBudgetStats();
+      }
+      scriptFrame(frame);
+      game.update(sf::seconds(FRAME_TIME));
+      // Keep the scripted state even if game logic wanted to move on
+      game.currentState = state;
+
+      DrawStats::reset();
+      const auto start = std::chrono::steady_clock::now();
+      game.renderScene(FRAME_TIME);
+      game.renderOverlay(game.renderTexture);
+      game.renderTexture.display();
+      // Wait for the GPU (or software rasterizer) so the frame is really done
+      (void)game.renderTexture.setActive(true);
+      glFinish();
+      const auto end = std::chrono::steady_clock::now();
+
+      if (frame >= warmupFrames) {
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        drawCalls += DrawStats::getDrawCalls();
+      }
+    }
+
+    BenchResult result;
+    result.name = name;
+    result.frames = static_cast<int>(times.size());
+    if (times.empty()) return result;
+
+    double sum = 0.0;
+    for (double t : times) sum += t;
+    std::sort(times.begin(), times.end());
+    auto percentile = [&](double p) {
+      const std::size_t index = static_cast<std::size_t>(p * (times.size() - 1) + 0.5);
+      return times[std::min(index, times.size() - 1)];
+    };
+
+    result.meanMs = sum / times.size();
+    result.p50Ms = percentile(0.50);
+    result.p95Ms = percentile(0.95);
+    result.p99Ms = percentile(0.99);
+    result.maxMs = times.back();
+    result.drawCallsPerFrame = static_cast<double>(drawCalls) / times.size();
+    const GameAnimationSystem::ParticleBudgetStats& budget =
+        game.getAnimationSystem()->getParticleBudgetStats();
+    result.bursts = budget.bursts;
+    result.throttledBursts = budget.throttledBursts;
+    result.droppedParticles = budget.droppedParticles;
+    return result;
+  }
+};
+
+} // namespace DP
+
+namespace {
+
+void writeJson(std::ostream& out, const std::string& renderer, int frames,
+               const std::vector<DP::BenchResult>& results) {
+  char line[384];
+  out << "{\n";
+  out << "  \"version\": \"" << DEERPORTAL_VERSION << "\",\n";
+  out << "  \"renderer\": \"";
+  for (char c : renderer) {
+    if (c != '"' && c != '\\') out << c;
+  }
+  out << "\",\n";
+  out << "  \"framesPerState\": " << frames << ",\n";
+  out << "  \"states\": [\n";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const DP::BenchResult& r = results[i];
+    std::snprintf(line, sizeof(line),
+                  "    {\"name\": \"%s\", \"frames\": %d, \"meanMs\": %.3f, \"p50Ms\": %.3f, "
+                  "\"p95Ms\": %.3f, \"p99Ms\": %.3f, \"maxMs\": %.3f, \"drawCalls\": %.1f, "
+                  "\"bursts\": %u, \"throttledBursts\": %u, \"droppedParticles\": %u}%s\n",
+                  r.name.c_str(), r.frames, r.meanMs, r.p50Ms, r.p95Ms, r.p99Ms, r.maxMs,
+                  r.drawCallsPerFrame, r.bursts, r.throttledBursts, r.droppedParticles,
+                  i + 1 < results.size() ? "," : "");
+    out << line;
+  }
+  out << "  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  int frames = 300;
+  int warmupFrames = 30;
+  std::string output = "renderbench.json";
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    if (arg == "--frames" && i + 1 < argc) {
+      frames = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--warmup" && i + 1 < argc) {
+      warmupFrames = std::max(0, std::atoi(argv[++i]));
+    } else if (arg == "--output" && i + 1 < argc) {
+      output = argv[++i];
+    } else {
+      std::cerr << "Usage: deerportal-renderbench [--frames N] [--warmup N] [--output FILE]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  try {
+    // Fixed seed so every run scripts the same dice, AI moves, diamond layout,
+    // card piles and bursts. Nothing else in the game reseeds std::rand.
+    std::srand(1);
+    sf::Listener::setGlobalVolume(0.0f);
+
+    DP::Game game(true);
+    DP::RenderBench bench(game, frames, warmupFrames);
+    const std::vector<DP::BenchResult> results = bench.runAll();
+    const std::string renderer = bench.getRendererName();
+
+    std::ofstream file(output);
+    if (!file) {
+      std::cerr << "renderbench: cannot write " << output << std::endl;
+      return 1;
+    }
+    writeJson(file, renderer, frames, results);
+
+    std::cout << "Renderer: " << renderer << std::endl;
+    for (const DP::BenchResult& r : results) {
+      std::printf("%-16s p50 %7.3f  p95 %7.3f  p99 %7.3f ms  draws %6.1f\n", r.name.c_str(),
+                  r.p50Ms, r.p95Ms, r.p99Ms, r.drawCallsPerFrame);
+    }
+    std::cout << "Results written to " << output << std::endl;
+    return 0;
+  } catch (const std::exception& e) {
+    std::cerr << "renderbench: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -3,23 +3,29 @@
 #include <string> // For std::string
 
 #include "data.h" // For ASSETS_PATH
+#include "draw-stats.h"
 #include "exceptions.h"
+#include "shared-assets.h"
 #include "textureholder.h"
 
 RotateElem::RotateElem(TextureHolder* textures) : timeCounter(0), active(true) {
-  if (!textureRotate.loadFromFile(get_full_path(std::string(ASSETS_PATH) + "img/rotate.png"))) {
+  textureRotate = DP::SharedAssets::getInstance().getTexture("img/rotate.png");
+  if (!textureRotate) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE, "img/rotate.png",
                                          "Failed to load rotate element texture");
   }
 
-  spriteRotate = std::make_unique<sf::Sprite>(textureRotate);
+  spriteRotate = std::make_unique<sf::Sprite>(*textureRotate);
   spriteRotate->scale(sf::Vector2f(0.7f, 0.7f));
   spriteRotate->setOrigin(sf::Vector2f(32.f, 32.f));
 }
 
 void RotateElem::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   states.transform *= getTransform();
-  if (spriteRotate) target.draw(*spriteRotate, states);
+  if (spriteRotate) {
+    target.draw(*spriteRotate, states);
+    DP::DrawStats::count();
+  }
 }
 
 void RotateElem::update(sf::Time deltaTime) {
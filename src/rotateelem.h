@@ -1,5 +1,7 @@
 #ifndef ROTATEELEM_H
 #define ROTATEELEM_H
+#include <memory>
+
 #include <SFML/Graphics.hpp>
 
 #include "data.h"
@@ -14,7 +16,7 @@ public:
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
   void update(sf::Time deltaTime);
 
-  sf::Texture textureRotate;
+  std::shared_ptr<const sf::Texture> textureRotate; // Same for both arrows
   std::unique_ptr<sf::Sprite> spriteRotate;
   void setColor();
 
@@ -1,27 +1,24 @@
 #include "rounddice.h"
 
 #include "data.h"
+#include "draw-stats.h"
 #include "exceptions.h"
-#include "filetools.h"
+#include "shared-assets.h"
 #include "textureholder.h"
 
-RoundDice::RoundDice(Player (&players)[4]) : sfxDice(sfxDiceBuffer) {
+RoundDice::RoundDice(Player (&players)[4]) : revision(0) {
   playersHud = players;
   diceResult = 1;
   diceResultSix = 6;
   diceSize = 150;
-  if (!sfxDiceBuffer.loadFromFile(get_full_path(ASSETS_PATH "audio/dice.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "audio/dice.ogg",
-                                         "Failed to load dice sound effect");
-  }
 
-  if (!textureDice.loadFromFile(get_full_path(ASSETS_PATH "img/diceWhite.png"))) {
+  textureDice = DP::SharedAssets::getInstance().getTexture("img/diceWhite.png");
+  if (!textureDice) {
     throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
                                          "img/diceWhite.png", "Failed to load dice texture");
   }
 
-  spriteDice = std::make_unique<sf::Sprite>(textureDice);
-  sfxDice.setVolume(12);
+  spriteDice = std::make_unique<sf::Sprite>(*textureDice);
   spriteDice->setPosition(sf::Vector2f(1140, 550));
   setDiceTexture();
 }
@@ -29,11 +26,13 @@ RoundDice::RoundDice(Player (&players)[4]) : sfxDice(sfxDiceBuffer) {
 void RoundDice::setDiceTexture() {
   sf::IntRect diceRect({diceSize * diceResultSix, 0}, {diceSize, diceSize});
   spriteDice->setTextureRect(diceRect);
+  revision++;
 }
 
 void RoundDice::setColor(int playerNumber) {
   sf::Color color(DP::playersColors[playerNumber]);
   spriteDice->setColor(color);
+  revision++;
 }
 
 void RoundDice::setDiceTexture(int diceResult) {
@@ -55,14 +54,12 @@ std::string RoundDice::drawRound() {
 }
 
 int RoundDice::throwDice() {
-  sfxDice.play();
   int result = rand() % 100;
   diceResult = result;
   return result;
 }
 
 int RoundDice::throwDiceSix() {
-  sfxDice.play();
   int result = rand() % 6;
   diceResultSix = result;
   setDiceTexture();
@@ -71,7 +68,10 @@ int RoundDice::throwDiceSix() {
 }
 
 void RoundDice::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-  if (spriteDice) target.draw(*spriteDice, states);
+  if (spriteDice) {
+    target.draw(*spriteDice, states);
+    DP::DrawStats::count();
+  }
 }
 
 void RoundDice::setFaces(int number) {
@@ -2,7 +2,6 @@
 #define ROUNDDICE_H
 #include <random>
 
-#include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
 
 #include "playerhud.h"
@@ -16,7 +15,7 @@ public:
   int diceResult;
   int diceResultSix;
   int throwDiceSix();
-  sf::Texture textureDice;
+  std::shared_ptr<const sf::Texture> textureDice;
   std::unique_ptr<sf::Sprite> spriteDice;
   void setDiceTexture();
   void setDiceTexture(int diceResult);
@@ -28,15 +27,18 @@ public:
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
   void setFaces(int number);
 
+  /*!
+   * \brief getRevision changes whenever the dice face or colour changes
+   */
+  unsigned int getRevision() const { return revision; }
+
 private:
   int throwDice();
 
   int diceSize;
+  unsigned int revision;
 
   //    void eventExtraCash();
-
-  sf::SoundBuffer sfxDiceBuffer;
-  sf::Sound sfxDice;
 };
 
 #endif // ROUNDDICE_H
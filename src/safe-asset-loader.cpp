@@ -1,18 +1,19 @@
 #include "safe-asset-loader.h"
 
 #include <filesystem>
-#include <fstream>
 #include <iostream>
 
+#include "asset-archive.h"
 #include "error-handler.h"
 #include "filetools.h"
 
 namespace DeerPortal {
 
-std::vector<std::string> SafeAssetLoader::searchPaths;
-bool SafeAssetLoader::searchPathsInitialized = false;
-
 void SafeAssetLoader::loadTexture(sf::Texture& texture, const std::string& filename) {
+  if (const DP::AssetArchive::Entry* entry = DP::AssetArchive::getInstance().find(filename)) {
+    if (texture.loadFromMemory(entry->data, entry->size)) return;
+  }
+
   std::string fullPath = getFullPath(filename);
 
   if (!texture.loadFromFile(fullPath)) {
@@ -23,6 +24,11 @@ void SafeAssetLoader::loadTexture(sf::Texture& texture, const std::string& filen
 
 void SafeAssetLoader::loadFont(sf::Font& font, const std::string& filename,
                                const std::string& fallbackFont) {
+  // The font keeps reading from the mapping, which stays open for the whole run
+  if (const DP::AssetArchive::Entry* entry = DP::AssetArchive::getInstance().find(filename)) {
+    if (font.openFromMemory(entry->data, entry->size)) return;
+  }
+
   std::string fullPath = getFullPath(filename);
 
   if (!font.openFromFile(fullPath)) {
@@ -51,6 +57,10 @@ void SafeAssetLoader::loadFont(sf::Font& font, const std::string& filename,
 }
 
 void SafeAssetLoader::loadSound(sf::SoundBuffer& buffer, const std::string& filename) {
+  if (const DP::AssetArchive::Entry* entry = DP::AssetArchive::getInstance().find(filename)) {
+    if (buffer.loadFromMemory(entry->data, entry->size)) return;
+  }
+
   std::string fullPath = getFullPath(filename);
 
   if (!buffer.loadFromFile(fullPath)) {
@@ -60,26 +70,7 @@ void SafeAssetLoader::loadSound(sf::SoundBuffer& buffer, const std::string& file
 }
 
 std::string SafeAssetLoader::findAssetPath(const std::string& filename) {
-  if (!searchPathsInitialized) {
-    initializeSearchPaths();
-  }
-
-  // Try the get_full_path function first
-  std::string fullPath = getFullPath(filename);
-  if (fileExists(fullPath)) {
-    return fullPath;
-  }
-
-  // Try each search path
-  for (const auto& path : searchPaths) {
-    std::string candidate = path + "/" + filename;
-    if (fileExists(candidate)) {
-      return candidate;
-    }
-  }
-
-  // Return original path if not found
-  return fullPath;
+  return DP::AssetPaths::getInstance().find(filename);
 }
 
 void SafeAssetLoader::createFallbackTexture(sf::Texture& texture, sf::Color color,
@@ -112,32 +103,15 @@ bool SafeAssetLoader::loadFallbackFont(sf::Font& font) {
 }
 
 void SafeAssetLoader::addSearchPath(const std::string& path) {
-  if (!searchPathsInitialized) {
-    initializeSearchPaths();
-  }
-  searchPaths.push_back(path);
+  DP::AssetPaths::getInstance().addSearchPath(path);
 }
 
 void SafeAssetLoader::clearSearchPaths() {
-  searchPaths.clear();
-  searchPathsInitialized = false;
+  DP::AssetPaths::getInstance().resetSearchPaths();
 }
 
 bool SafeAssetLoader::fileExists(const std::string& filename) {
-  std::ifstream file(filename);
-  return file.good();
-}
-
-void SafeAssetLoader::initializeSearchPaths() {
-  if (searchPathsInitialized) {
-    return;
-  }
-
-  searchPaths = {".", "./assets", "../assets",
-                 "./Resources", // macOS app bundle
-                 "../Resources"};
-
-  searchPathsInitialized = true;
+  return DP::AssetPaths::fileExists(filename);
 }
 
 std::string SafeAssetLoader::getFullPath(const std::string& filename) {
@@ -21,7 +21,7 @@ public:
   // Load sound with error recovery
   static void loadSound(sf::SoundBuffer& buffer, const std::string& filename);
 
-  // Try multiple paths for asset loading
+  // Try multiple paths for asset loading; cached per file by DP::AssetPaths
   static std::string findAssetPath(const std::string& filename);
 
   // Create fallback texture (colored rectangle)
@@ -31,7 +31,7 @@ public:
   // Create fallback font (system default)
   static bool loadFallbackFont(sf::Font& font);
 
-  // Set asset search paths
+  // Set asset search paths; clearing goes back to the default paths
   static void addSearchPath(const std::string& path);
   static void clearSearchPaths();
 
@@ -39,12 +39,6 @@ public:
   static bool fileExists(const std::string& filename);
 
 private:
-  static std::vector<std::string> searchPaths;
-  static bool searchPathsInitialized;
-
-  // Initialize default search paths
-  static void initializeSearchPaths();
-
   // Get full path using get_full_path function
   static std::string getFullPath(const std::string& filename);
 };
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+
+#include <SFML/Graphics.hpp>
+
+#include "draw-stats.h"
+
+namespace DP {
+
+/*!
+ * \brief SceneRenderTexture is the game's off-screen scene target
+ *
+ * Draws issued directly on the scene texture are added to DrawStats. A
+ * drawable only counts when it is one of SFML's leaf types; game drawables
+ * count the leaves their own draw() submits, as do subsystems that receive
+ * the texture as a plain sf::RenderTarget&.
+ */
+class SceneRenderTexture : public sf::RenderTexture {
+public:
+  void draw(const sf::Drawable& drawable,
+            const sf::RenderStates& states = sf::RenderStates::Default) {
+    if (isLeaf(drawable)) DrawStats::count();
+    sf::RenderTexture::draw(drawable, states);
+  }
+
+  void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+            const sf::RenderStates& states = sf::RenderStates::Default) {
+    DrawStats::count();
+    sf::RenderTexture::draw(vertices, vertexCount, type, states);
+  }
+
+  void draw(const sf::VertexBuffer& vertexBuffer,
+            const sf::RenderStates& states = sf::RenderStates::Default) {
+    DrawStats::count();
+    sf::RenderTexture::draw(vertexBuffer, states);
+  }
+
+  void draw(const sf::VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount,
+            const sf::RenderStates& states = sf::RenderStates::Default) {
+    DrawStats::count();
+    sf::RenderTexture::draw(vertexBuffer, firstVertex, vertexCount, states);
+  }
+
+private:
+  static bool isLeaf(const sf::Drawable& drawable) {
+    return dynamic_cast<const sf::Sprite*>(&drawable) || dynamic_cast<const sf::Text*>(&drawable) ||
+           dynamic_cast<const sf::Shape*>(&drawable) ||
+           dynamic_cast<const sf::VertexArray*>(&drawable) ||
+           dynamic_cast<const sf::VertexBuffer*>(&drawable);
+  }
+};
+
+} // namespace DP
@@ -1,6 +1,9 @@
 #include "selector.h"
 
-Selector::Selector(int squareSize) : rectangle(sf::Vector2f(squareSize - 1, squareSize - 1)) {
+#include "draw-stats.h"
+
+Selector::Selector(int squareSize)
+    : rectangle(sf::Vector2f(squareSize - 1, squareSize - 1)), revision(0) {
   this->squareSize = squareSize;
   rectangle.setFillColor(sf::Color(150, 250, 150, 168));
 
@@ -13,10 +16,12 @@ void Selector::changeColor(int colorNumber) {
   sf::Color color(DP::playersColors[colorNumber]);
   color.a = 128;
   rectangle.setFillColor(color);
+  revision++;
 }
 
 void Selector::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   //   // apply the transform
   states.transform *= getTransform();
   target.draw(rectangle, states);
+  DP::DrawStats::count();
 }
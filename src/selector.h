@@ -12,10 +12,16 @@ public:
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
   void changeColor(int colorNumber);
 
+  /*!
+   * \brief getRevision changes whenever the selector colour changes
+   */
+  unsigned int getRevision() const { return revision; }
+
   int squareSize;
 
 private:
   sf::RectangleShape rectangle;
+  unsigned int revision;
 };
 
 #endif // SELECTOR_H
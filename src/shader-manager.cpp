@@ -0,0 +1,124 @@
+#include "shader-manager.h"
+
+#include <iostream>
+
+#include "asset-archive.h"
+#include "error-handler.h"
+#include "startup-timer.h"
+
+namespace DP {
+
+ShaderManager::ShaderManager()
+  : nextJob(0)
+  , warmupTargetReady(false) {}
+
+void ShaderManager::addFragmentFile(const std::string& name, sf::Shader& shader,
+                                    const std::string& path) {
+  Job job;
+  job.name = name;
+  job.shader = &shader;
+  job.path = path;
+  job.source = std::async(std::launch::async, readAssetText, path);
+  jobs.push_back(std::move(job));
+}
+
+void ShaderManager::addCustom(const std::string& name, sf::Shader& shader,
+                              std::function<bool()> compile) {
+  Job job;
+  job.name = name;
+  job.shader = &shader;
+  job.compile = std::move(compile);
+  jobs.push_back(std::move(job));
+}
+
+bool ShaderManager::compileNext() {
+  if (isComplete()) {
+    return false;
+  }
+
+  Job& job = jobs[nextJob++];
+  ShaderTiming timing;
+  timing.name = job.name;
+
+  sf::Clock clock;
+  if (job.compile) {
+    timing.loaded = job.compile();
+  } else {
+    const std::string source = job.source.get();
+    clock.restart(); // Do not count the wait for the file
+    timing.loaded =
+        !source.empty() && job.shader->loadFromMemory(source, sf::Shader::Type::Fragment);
+    if (!timing.loaded) {
+      DeerPortal::ErrorHandler::getInstance().logError(DeerPortal::AssetLoadException(
+          DeerPortal::AssetLoadException::SHADER, job.path,
+          "Failed to load " + job.name + " shader - visual effects disabled"));
+    }
+  }
+  timing.compileMs = clock.restart().asSeconds() * 1000.0f;
+
+  if (timing.loaded) {
+    warmUp(*job.shader);
+    timing.warmupMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+  }
+
+  timings.push_back(timing);
+  return true;
+}
+
+void ShaderManager::warmUp(sf::Shader& shader) {
+  if (!warmupTargetReady) {
+    warmupTargetReady = warmupTarget.resize(sf::Vector2u(4, 4));
+    if (!warmupTargetReady) return;
+  }
+
+  // A tiny off-screen draw makes the driver finish linking and build the
+  // program variant for SFML's vertex layout now rather than on first use.
+  const sf::Vertex quad[] = {
+      sf::Vertex{{0.0f, 0.0f}, sf::Color::White, {0.0f, 0.0f}},
+      sf::Vertex{{4.0f, 0.0f}, sf::Color::White, {1.0f, 0.0f}},
+      sf::Vertex{{4.0f, 4.0f}, sf::Color::White, {1.0f, 1.0f}},
+      sf::Vertex{{0.0f, 0.0f}, sf::Color::White, {0.0f, 0.0f}},
+      sf::Vertex{{4.0f, 4.0f}, sf::Color::White, {1.0f, 1.0f}},
+      sf::Vertex{{0.0f, 4.0f}, sf::Color::White, {0.0f, 1.0f}},
+  };
+  warmupTarget.clear(sf::Color::Transparent);
+  warmupTarget.draw(quad, 6, sf::PrimitiveType::Triangles, &shader);
+  warmupTarget.display();
+}
+
+float ShaderManager::getProgress() const {
+  return jobs.empty() ? 1.0f : static_cast<float>(nextJob) / static_cast<float>(jobs.size());
+}
+
+std::string ShaderManager::getCurrentName() const {
+  return isComplete() ? std::string() : jobs[nextJob].name;
+}
+
+float ShaderManager::getTotalMs() const {
+  float total = 0.0f;
+  for (const ShaderTiming& timing : timings) {
+    total += timing.compileMs + timing.warmupMs;
+  }
+  return total;
+}
+
+void ShaderManager::logReport() const {
+  // Per-shader times go into the startup breakdown in every build
+  StartupTimer& startupTimer = StartupTimer::getInstance();
+  for (const ShaderTiming& timing : timings) {
+    startupTimer.addNested("shader:" + timing.name, timing.compileMs);
+    startupTimer.addNested("shader:" + timing.name + ":warmup", timing.warmupMs);
+  }
+
+#ifndef NDEBUG
+  for (const ShaderTiming& timing : timings) {
+    std::cout << "Shader " << timing.name << ": " << (timing.loaded ? "compiled" : "FAILED")
+              << " in " << timing.compileMs << " ms, warm-up " << timing.warmupMs << " ms"
+              << std::endl;
+  }
+  std::cout << "Shaders: " << timings.size() << " ready in " << getTotalMs() << " ms"
+            << std::endl;
+#endif
+}
+
+} // namespace DP
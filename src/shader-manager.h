@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+namespace DP {
+
+/*!
+ * \brief ShaderManager compiles every shader during the loading screen
+ *
+ * Shader sources are read from disk on a worker thread as soon as they are
+ * queued. Compiling and linking must happen on the thread that owns the GL
+ * context, so compileNext() builds one shader at a time and the caller
+ * presents a progress frame in between. Each shader is then warmed with a
+ * dummy draw so the driver finishes any deferred linking before gameplay.
+ */
+class ShaderManager {
+public:
+  struct ShaderTiming {
+    std::string name;
+    float compileMs = 0.0f;
+    float warmupMs = 0.0f;
+    bool loaded = false;
+  };
+
+  ShaderManager();
+
+  /*!
+   * \brief addFragmentFile queues a fragment shader loaded from a file
+   * \param name Short name used in progress text and timing reports
+   * \param shader Shader object to compile into
+   * \param path Source inside the assets directory, e.g. "shaders/blur.frag"
+   */
+  void addFragmentFile(const std::string& name, sf::Shader& shader, const std::string& path);
+
+  /*!
+   * \brief addCustom queues a shader compiled by its owner, e.g. embedded
+   * sources with fallbacks
+   * \param compile Compiles into shader and returns true on success
+   */
+  void addCustom(const std::string& name, sf::Shader& shader, std::function<bool()> compile);
+
+  /*!
+   * \brief compileNext compiles and warms up the next queued shader
+   * \return false once the queue is empty
+   */
+  bool compileNext();
+
+  bool isComplete() const { return nextJob >= jobs.size(); }
+  float getProgress() const;
+  std::string getCurrentName() const;
+
+  const std::vector<ShaderTiming>& getTimings() const { return timings; }
+  float getTotalMs() const;
+  // Adds shader:<name> and shader:<name>:warmup to the StartupTimer; prints them in debug builds
+  void logReport() const;
+
+private:
+  struct Job {
+    std::string name;
+    sf::Shader* shader = nullptr;
+    std::function<bool()> compile;
+    std::string path;
+    std::future<std::string> source; // Only for file jobs
+  };
+
+  std::vector<Job> jobs;
+  std::size_t nextJob;
+  std::vector<ShaderTiming> timings;
+
+  sf::RenderTexture warmupTarget;
+  bool warmupTargetReady;
+
+  void warmUp(sf::Shader& shader);
+};
+
+} // namespace DP
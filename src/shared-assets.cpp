@@ -0,0 +1,49 @@
+#include "shared-assets.h"
+
+#include <iostream>
+
+#include "asset-archive.h"
+
+namespace DP {
+
+SharedAssets& SharedAssets::getInstance() {
+  static SharedAssets instance;
+  return instance;
+}
+
+template <typename T, typename Load>
+std::shared_ptr<const T>
+SharedAssets::acquire(std::unordered_map<std::string, std::weak_ptr<const T>>& cache,
+                      const std::string& file, Load load) {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto cached = cache.find(file);
+  if (cached != cache.end()) {
+    if (std::shared_ptr<const T> resource = cached->second.lock()) {
+      return resource;
+    }
+  }
+
+  std::shared_ptr<T> resource = std::make_shared<T>();
+  if (!load(*resource, file)) {
+    // Not remembered, so a later holder tries again
+    return nullptr;
+  }
+#ifndef NDEBUG
+  std::cout << "SharedAssets: loaded " << file << std::endl;
+#endif
+  cache[file] = resource;
+  return resource;
+}
+
+std::shared_ptr<const sf::Texture> SharedAssets::getTexture(const std::string& file) {
+  return acquire(textures, file, [](sf::Texture& texture, const std::string& name) {
+    return loadAsset(texture, name);
+  });
+}
+
+std::shared_ptr<const sf::Font> SharedAssets::getFont(const std::string& file) {
+  return acquire(fonts, file,
+                 [](sf::Font& font, const std::string& name) { return openAsset(font, name); });
+}
+
+} // namespace DP
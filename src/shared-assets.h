@@ -0,0 +1,45 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <SFML/Graphics.hpp>
+
+namespace DP {
+
+/*!
+ * \brief SharedAssets hands out one copy of a texture or font per file
+ *
+ * Objects that are built several times, such as GUI windows and rotate
+ * markers, hold a shared_ptr instead of their own copy. A file is decoded and
+ * uploaded by the first holder; later ones get the same object. The cache only
+ * keeps weak references, so the resource goes away with its last holder.
+ */
+class SharedAssets {
+public:
+  static SharedAssets& getInstance();
+
+  /*!
+   * \brief getTexture returns the texture of a file, loading it on first use
+   * \param file Path relative to the assets directory, e.g. "img/rotate.png"
+   * \return nullptr when the file cannot be loaded
+   */
+  std::shared_ptr<const sf::Texture> getTexture(const std::string& file);
+
+  // Like getTexture(); the font keeps reading from its file or the archive
+  std::shared_ptr<const sf::Font> getFont(const std::string& file);
+
+private:
+  SharedAssets() = default;
+
+  template <typename T, typename Load>
+  std::shared_ptr<const T> acquire(std::unordered_map<std::string, std::weak_ptr<const T>>& cache,
+                                   const std::string& file, Load load);
+
+  std::unordered_map<std::string, std::weak_ptr<const sf::Texture>> textures;
+  std::unordered_map<std::string, std::weak_ptr<const sf::Font>> fonts;
+  std::mutex mutex;
+};
+
+} // namespace DP
@@ -0,0 +1,125 @@
+#include "sound-engine.h"
+
+#include "profiler.h"
+
+namespace DP {
+
+static_assert((SoundEngine::QUEUE_SIZE & (SoundEngine::QUEUE_SIZE - 1)) == 0,
+              "QUEUE_SIZE must be a power of two");
+
+SoundEngine::SoundEngine() : startCounter(0), enqueuePosition(0), dequeuePosition(0) {
+  voices.reserve(VOICE_COUNT);
+  for (std::size_t i = 0; i < VOICE_COUNT; ++i) {
+    voices.emplace_back(silence);
+  }
+  for (std::size_t i = 0; i < QUEUE_SIZE; ++i) {
+    queue[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+SoundEngine::SoundId SoundEngine::addSound(const sf::SoundBuffer& buffer,
+                                           const Settings& settings) {
+  sounds.push_back({&buffer, settings});
+  return sounds.size() - 1;
+}
+
+bool SoundEngine::play(SoundId sound) {
+  // Each slot's sequence tells whose turn it is, so producers only race on
+  // the position counter
+  std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = queue[position & (QUEUE_SIZE - 1)];
+    const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence == position) {
+      if (enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed)) {
+        slot.sound = sound;
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (sequence < position) {
+      return false; // Full; a dropped effect beats blocking the caller
+    } else {
+      position = enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void SoundEngine::update() {
+  DP_PROFILE_ZONE("SoundEngine::update");
+  for (;;) {
+    Slot& slot = queue[dequeuePosition & (QUEUE_SIZE - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+      break;
+    }
+    const SoundId sound = slot.sound;
+    slot.sequence.store(dequeuePosition + QUEUE_SIZE, std::memory_order_release);
+    ++dequeuePosition;
+
+    if (sound >= sounds.size() || sounds[sound].buffer->getSampleCount() == 0) {
+      continue;
+    }
+    if (Voice* voice = findVoice(sound)) {
+      start(*voice, sound);
+    }
+  }
+}
+
+bool SoundEngine::isPlaying(const Voice& voice) const {
+  return voice.used && voice.sound.getStatus() != sf::SoundSource::Status::Stopped;
+}
+
+SoundEngine::Voice* SoundEngine::findVoice(SoundId sound) {
+  const Settings& settings = sounds[sound].settings;
+
+  // At the effect's own limit its oldest copy restarts
+  unsigned int copies = 0;
+  Voice* oldestCopy = nullptr;
+  Voice* freeVoice = nullptr;
+  for (Voice& voice : voices) {
+    if (!isPlaying(voice)) {
+      if (!freeVoice) freeVoice = &voice;
+      continue;
+    }
+    if (voice.owner == sound) {
+      ++copies;
+      if (!oldestCopy || voice.startedAt < oldestCopy->startedAt) oldestCopy = &voice;
+    }
+  }
+  if (settings.maxVoices > 0 && copies >= settings.maxVoices) {
+    return oldestCopy;
+  }
+  if (freeVoice) {
+    return freeVoice;
+  }
+
+  // All voices busy: take the oldest of the lowest priority, if not above ours
+  Voice* victim = nullptr;
+  for (Voice& voice : voices) {
+    const int priority = sounds[voice.owner].settings.priority;
+    if (priority > settings.priority) continue;
+    if (!victim) {
+      victim = &voice;
+      continue;
+    }
+    const int victimPriority = sounds[victim->owner].settings.priority;
+    if (priority < victimPriority ||
+        (priority == victimPriority && voice.startedAt < victim->startedAt)) {
+      victim = &voice;
+    }
+  }
+  return victim;
+}
+
+void SoundEngine::start(Voice& voice, SoundId sound) {
+  const Sound& effect = sounds[sound];
+  voice.sound.stop();
+  voice.sound.setBuffer(*effect.buffer);
+  voice.sound.setVolume(effect.settings.volume);
+  voice.sound.play();
+  voice.owner = sound;
+  voice.startedAt = ++startCounter;
+  voice.used = true;
+}
+
+} // namespace DP
@@ -0,0 +1,89 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Audio.hpp>
+
+namespace DP {
+
+/*!
+ * \brief SoundEngine plays short effects on a fixed pool of voices
+ *
+ * Every effect can overlap with itself up to its own voice limit, so quick
+ * runs of the same effect no longer cut each other off. When all voices are
+ * busy, the oldest voice of the lowest priority not above the new effect is
+ * taken over; otherwise the new effect is dropped.
+ *
+ * play() only puts the effect in a lock-free queue and may be called from any
+ * thread. update() starts the queued effects and must run on the main thread
+ * once per frame. Buffers hold decoded PCM and must outlive the engine; an
+ * empty buffer (not loaded yet, or released) is skipped.
+ */
+class SoundEngine {
+public:
+  using SoundId = std::size_t;
+
+  struct Settings {
+    float volume = 100.0f;
+    unsigned int maxVoices = 2; // Copies of this effect playing at once
+    int priority = 0;           // Higher priorities may steal lower voices
+  };
+
+  static constexpr std::size_t VOICE_COUNT = 16;
+  static constexpr std::size_t QUEUE_SIZE = 64; // Power of two
+
+  SoundEngine();
+
+  SoundEngine(const SoundEngine&) = delete;
+  SoundEngine& operator=(const SoundEngine&) = delete;
+
+  // Main thread, before anything is played
+  SoundId addSound(const sf::SoundBuffer& buffer, const Settings& settings);
+
+  /*!
+   * \brief play queues an effect; lock-free, from any thread
+   * \return false if the queue is full and the effect was dropped
+   */
+  bool play(SoundId sound);
+
+  // Main thread; starts the queued effects
+  void update();
+
+private:
+  struct Sound {
+    const sf::SoundBuffer* buffer;
+    Settings settings;
+  };
+
+  struct Voice {
+    explicit Voice(const sf::SoundBuffer& silence) : sound(silence) {}
+    sf::Sound sound;
+    SoundId owner = 0;
+    std::uint64_t startedAt = 0;
+    bool used = false;
+  };
+
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    SoundId sound;
+  };
+
+  std::vector<Sound> sounds;
+  sf::SoundBuffer silence; // Voices need some buffer before their first effect
+  std::vector<Voice> voices;
+  std::uint64_t startCounter;
+
+  // Bounded multi-producer queue; update() is the only consumer
+  std::array<Slot, QUEUE_SIZE> queue;
+  std::atomic<std::size_t> enqueuePosition;
+  std::size_t dequeuePosition;
+
+  bool isPlaying(const Voice& voice) const;
+  Voice* findVoice(SoundId sound);
+  void start(Voice& voice, SoundId sound);
+};
+
+} // namespace DP
@@ -1,58 +1,63 @@
 #include "soundfx.h"
 
-#include "exceptions.h"
-
 SoundFX::SoundFX()
-    : soundPortal(bufferPortal), soundDeerMode(bufferDeerMode), soundMeditation(bufferMeditation),
-      soundCollect(soundCollectBuffer), soundCard(soundCardBuffer),
-      soundLetsBegin(soundLetsBeginBuffer) {
-  if (!soundCollectBuffer.loadFromFile(get_full_path(ASSETS_PATH "audio/collect.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "audio/collect.ogg",
-                                         "Failed to load collect sound effect");
-  }
-  if (!soundCardBuffer.loadFromFile(get_full_path(ASSETS_PATH "audio/card.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "audio/card.ogg",
-                                         "Failed to load card sound effect");
-  }
-  if (!bufferDeerMode.loadFromFile(get_full_path(ASSETS_PATH "audio/dp-deermode.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND,
-                                         "audio/dp-deermode.ogg",
-                                         "Failed to load deer mode sound effect");
-  }
-  if (!bufferMeditation.loadFromFile(get_full_path(ASSETS_PATH "audio/dp-meditation.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND,
-                                         "audio/dp-meditation.ogg",
-                                         "Failed to load meditation sound effect");
-  }
-  if (!bufferPortal.loadFromFile(get_full_path(ASSETS_PATH "audio/dp-ok.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND, "audio/dp-ok.ogg",
-                                         "Failed to load portal sound effect");
-  }
-
-  if (!soundLetsBeginBuffer.loadFromFile(get_full_path(ASSETS_PATH "audio/letsbegin.ogg"))) {
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::SOUND,
-                                         "audio/letsbegin.ogg",
-                                         "Failed to load lets begin sound effect");
-  }
-
-  // Set volume for sounds (buffers already set in initializer list)
-  soundCollect.setVolume(20);
-  soundCard.setVolume(20); // Fixed missing volume
-  soundLetsBegin.setVolume(20);
-  soundPortal.setVolume(20);
-  soundDeerMode.setVolume(40);
-  soundMeditation.setVolume(20);
+    : soundCollect(engine.addSound(soundCollectBuffer, {20, 4, 0})),
+      soundCard(engine.addSound(soundCardBuffer, {20, 2, 1})),
+      soundLetsBegin(engine.addSound(soundLetsBeginBuffer, {20, 1, 2})),
+      soundPortal(engine.addSound(bufferPortal, {20, 2, 2})),
+      soundDeerMode(engine.addSound(bufferDeerMode, {40, 1, 2})),
+      soundMeditation(engine.addSound(bufferMeditation, {20, 2, 1})),
+      soundClick(engine.addSound(bufferClick, {100, 3, 0})),
+      soundDice(engine.addSound(bufferDice, {12, 1, 1})) {
+  // Settings are {volume, voices of the same effect at once, priority}
+}
+
+void SoundFX::addTo(DP::AssetStreamer::Manifest& manifest) {
+  manifest.addSound(soundCollectBuffer, "audio/collect.ogg",
+                    "Failed to load collect sound effect");
+  manifest.addSound(soundCardBuffer, "audio/card.ogg", "Failed to load card sound effect");
+  manifest.addSound(bufferDeerMode, "audio/dp-deermode.ogg",
+                    "Failed to load deer mode sound effect");
+  manifest.addSound(bufferMeditation, "audio/dp-meditation.ogg",
+                    "Failed to load meditation sound effect");
+  manifest.addSound(bufferPortal, "audio/dp-ok.ogg", "Failed to load portal sound effect");
+  manifest.addSound(bufferDice, "audio/dice.ogg", "Failed to load dice sound effect");
+  manifest.addSound(soundLetsBeginBuffer, "audio/letsbegin.ogg",
+                    "Failed to load lets begin sound effect");
+}
+
+void SoundFX::update() {
+  engine.update();
 }
 
 void SoundFX::playCollect() {
-  soundCollect.play();
+  engine.play(soundCollect);
 }
 
 void SoundFX::playCard() {
-  soundCard.play();
+  engine.play(soundCard);
 }
 
 void SoundFX::playLetsBegin() {
-  //    std::cout << "playing.... begin lets" << std::endl;
-  soundLetsBegin.play();
+  engine.play(soundLetsBegin);
+}
+
+void SoundFX::playPortal() {
+  engine.play(soundPortal);
+}
+
+void SoundFX::playDeerMode() {
+  engine.play(soundDeerMode);
+}
+
+void SoundFX::playMeditation() {
+  engine.play(soundMeditation);
+}
+
+void SoundFX::playClick() {
+  engine.play(soundClick);
+}
+
+void SoundFX::playDice() {
+  engine.play(soundDice);
 }
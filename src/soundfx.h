@@ -4,30 +4,53 @@
 
 #include <SFML/Audio.hpp>
 
+#include "asset-streamer.h"
 #include "filetools.h"
+#include "sound-engine.h"
 /*!
  * \brief The SoundFX various sounds
+ *
+ * Effects play on a shared pool of voices, so they may overlap. The play
+ * functions only queue the effect and are safe from any thread; update()
+ * starts them and runs once per frame on the main thread.
  */
 class SoundFX {
 public:
   SoundFX();
 
+  // Buffers are loaded with the manifest; effects are skipped until then
+  void addTo(DP::AssetStreamer::Manifest& manifest);
+  void update();
+
   sf::SoundBuffer soundCollectBuffer;
   sf::SoundBuffer soundCardBuffer;
   sf::SoundBuffer bufferDeerMode;
   sf::SoundBuffer bufferMeditation;
   sf::SoundBuffer bufferPortal;
-  sf::Sound soundPortal;
-  sf::Sound soundDeerMode;
-  sf::Sound soundMeditation;
-  sf::Sound soundCollect;
-  sf::Sound soundCard;
+  sf::SoundBuffer bufferClick; // Loaded by Game, which only reports a failure
+  sf::SoundBuffer bufferDice;
   void playCollect();
 
   sf::SoundBuffer soundLetsBeginBuffer;
-  sf::Sound soundLetsBegin;
   void playLetsBegin();
   void playCard();
+  void playPortal();
+  void playDeerMode();
+  void playMeditation();
+  void playClick();
+  void playDice();
+
+private:
+  // Declared after the buffers, so its voices are gone before them
+  DP::SoundEngine engine;
+  DP::SoundEngine::SoundId soundCollect;
+  DP::SoundEngine::SoundId soundCard;
+  DP::SoundEngine::SoundId soundLetsBegin;
+  DP::SoundEngine::SoundId soundPortal;
+  DP::SoundEngine::SoundId soundDeerMode;
+  DP::SoundEngine::SoundId soundMeditation;
+  DP::SoundEngine::SoundId soundClick;
+  DP::SoundEngine::SoundId soundDice;
 };
 
 #endif // SOUNDFX_H
@@ -0,0 +1,158 @@
+#include "spatial-grid.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace DP {
+
+SpatialGrid::SpatialGrid(sf::FloatRect bounds, int newColumns, int newRows)
+  : columns(std::max(1, newColumns))
+  , rows(std::max(1, newRows))
+  , visibleMin(0, 0)
+  , visibleMax(-1, -1)
+  , viewValid(false) {
+  setWorldBounds(bounds);
+}
+
+void SpatialGrid::setWorldBounds(sf::FloatRect bounds) {
+  worldBounds = bounds;
+  inverseCellSize = sf::Vector2f(bounds.size.x > 0.0f ? columns / bounds.size.x : 0.0f,
+                                 bounds.size.y > 0.0f ? rows / bounds.size.y : 0.0f);
+  viewValid = false;
+}
+
+int SpatialGrid::columnAt(float x) const {
+  const int column = static_cast<int>(std::floor((x - worldBounds.position.x) * inverseCellSize.x));
+  // The right world edge itself still belongs to the last column
+  return std::min(std::max(column, 0), columns - 1);
+}
+
+int SpatialGrid::rowAt(float y) const {
+  const int row = static_cast<int>(std::floor((y - worldBounds.position.y) * inverseCellSize.y));
+  return std::min(std::max(row, 0), rows - 1);
+}
+
+// Cells covered by the part of bounds inside the world; false when it misses the world
+bool SpatialGrid::cellRange(const sf::FloatRect& bounds, sf::Vector2i& first,
+                            sf::Vector2i& last) const {
+  const float worldRight = worldBounds.position.x + worldBounds.size.x;
+  const float worldBottom = worldBounds.position.y + worldBounds.size.y;
+  const float left = std::max(bounds.position.x, worldBounds.position.x);
+  const float top = std::max(bounds.position.y, worldBounds.position.y);
+  const float right = std::min(bounds.position.x + bounds.size.x, worldRight);
+  const float bottom = std::min(bounds.position.y + bounds.size.y, worldBottom);
+  if (left > right || top > bottom) {
+    return false;
+  }
+  first = sf::Vector2i(columnAt(left), rowAt(top));
+  last = sf::Vector2i(columnAt(right), rowAt(bottom));
+  return true;
+}
+
+void SpatialGrid::setView(const sf::View& view) {
+  // Only the part of the viewport inside the target is ever shown
+  const sf::FloatRect viewport = view.getViewport();
+  const float vpLeft = std::max(0.0f, viewport.position.x);
+  const float vpTop = std::max(0.0f, viewport.position.y);
+  const float vpRight = std::min(1.0f, viewport.position.x + viewport.size.x);
+  const float vpBottom = std::min(1.0f, viewport.position.y + viewport.size.y);
+
+  const sf::Vector2f size = view.getSize();
+  const sf::Vector2f origin = view.getCenter() - size / 2.0f;
+  sf::FloatRect bounds(origin, sf::Vector2f(0.0f, 0.0f));
+  if (vpRight > vpLeft && vpBottom > vpTop && viewport.size.x > 0.0f && viewport.size.y > 0.0f) {
+    const sf::Vector2f scale(size.x / viewport.size.x, size.y / viewport.size.y);
+    bounds.position = sf::Vector2f(origin.x + (vpLeft - viewport.position.x) * scale.x,
+                                   origin.y + (vpTop - viewport.position.y) * scale.y);
+    bounds.size = sf::Vector2f((vpRight - vpLeft) * scale.x, (vpBottom - vpTop) * scale.y);
+  }
+
+  if (viewValid && bounds == viewBounds) {
+    return;
+  }
+  viewBounds = bounds;
+  viewValid = true;
+  visibleBounds = sf::FloatRect();
+  visibleMin = sf::Vector2i(0, 0);
+  visibleMax = sf::Vector2i(-1, -1);
+
+  // Nothing of this view reaches the target, or it looks past the world
+  if (bounds.size.x <= 0.0f || bounds.size.y <= 0.0f) {
+    return;
+  }
+  const std::optional<sf::FloatRect> clipped = bounds.findIntersection(worldBounds);
+  if (!clipped) {
+    return;
+  }
+  visibleBounds = *clipped;
+  cellRange(visibleBounds, visibleMin, visibleMax);
+}
+
+int SpatialGrid::getCellIndex(sf::Vector2f position, float radius) const {
+  const float worldRight = worldBounds.position.x + worldBounds.size.x;
+  const float worldBottom = worldBounds.position.y + worldBounds.size.y;
+  if (position.x + radius < worldBounds.position.x || position.x - radius > worldRight ||
+      position.y + radius < worldBounds.position.y || position.y - radius > worldBottom) {
+    return -1;
+  }
+  return rowAt(position.y) * columns + columnAt(position.x);
+}
+
+bool SpatialGrid::getVisibleCells(float margin, sf::Vector2i& first, sf::Vector2i& last) const {
+  if (!viewValid) {
+    // Not keyed to a view yet - every cell counts as visible
+    first = sf::Vector2i(0, 0);
+    last = sf::Vector2i(columns - 1, rows - 1);
+    return true;
+  }
+  if (visibleMax.x < visibleMin.x) {
+    return false;
+  }
+  const sf::FloatRect grown(visibleBounds.position - sf::Vector2f(margin, margin),
+                            visibleBounds.size + sf::Vector2f(margin, margin) * 2.0f);
+  return cellRange(grown, first, last);
+}
+
+bool SpatialGrid::isVisible(sf::Vector2f position, float radius) const {
+  return isVisible(sf::FloatRect(position - sf::Vector2f(radius, radius),
+                                 sf::Vector2f(radius, radius) * 2.0f));
+}
+
+bool SpatialGrid::isVisible(const sf::FloatRect& bounds) const {
+  if (!viewValid) return true; // Not keyed to a view yet - cull nothing
+  sf::Vector2i first;
+  sf::Vector2i last;
+  if (!cellRange(bounds, first, last)) {
+    return false; // Entirely outside the world
+  }
+  return last.x >= visibleMin.x && first.x <= visibleMax.x && last.y >= visibleMin.y &&
+         first.y <= visibleMax.y;
+}
+
+int SpatialGrid::getVisibleCellCount() const {
+  if (!viewValid || visibleMax.x < visibleMin.x || visibleMax.y < visibleMin.y) return 0;
+  return (visibleMax.x - visibleMin.x + 1) * (visibleMax.y - visibleMin.y + 1);
+}
+
+void CellBins::build(const std::vector<int>& itemCells, int cellCount) {
+  // Counting sort: histogram, prefix sum, scatter
+  cellStart.assign(static_cast<std::size_t>(cellCount) + 1, 0);
+  for (const int cell : itemCells) {
+    if (cell >= 0) {
+      cellStart[cell + 1]++;
+    }
+  }
+  for (int cell = 0; cell < cellCount; ++cell) {
+    cellStart[cell + 1] += cellStart[cell];
+  }
+
+  items.resize(cellStart[cellCount]);
+  scatter.assign(cellStart.begin(), cellStart.end() - 1);
+  for (std::size_t i = 0; i < itemCells.size(); ++i) {
+    if (itemCells[i] >= 0) {
+      items[scatter[itemCells[i]]++] = static_cast<std::uint32_t>(i);
+    }
+  }
+}
+
+} // namespace DP
@@ -0,0 +1,106 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace DP {
+
+/*!
+ * \brief SpatialGrid is the broad-phase culling stage shared by particles,
+ * lights and the board animator
+ *
+ * The world rectangle is split into a fixed grid of cells. setView() maps
+ * the active sf::View (including a viewport that hangs off the target) to
+ * the range of cells it can show. Anything lying entirely outside the world
+ * belongs to no cell and is never visible; a view that misses the world
+ * shows no cells at all.
+ *
+ * Draw paths bin their items by cell (see CellBins) and only walk the
+ * visible cell range, so items in hidden cells are never touched. The
+ * visible range is cached per view rectangle, so every consumer can re-key
+ * the grid to its own target view before drawing at no real cost.
+ */
+class SpatialGrid {
+public:
+  static constexpr int DEFAULT_CELLS = 8;
+
+  explicit SpatialGrid(sf::FloatRect worldBounds = sf::FloatRect({0.0f, 0.0f}, {1360.0f, 768.0f}),
+                       int columns = DEFAULT_CELLS, int rows = DEFAULT_CELLS);
+
+  void setWorldBounds(sf::FloatRect bounds);
+  const sf::FloatRect& getWorldBounds() const { return worldBounds; }
+
+  /*!
+   * \brief setView marks the cells covered by the part of view that lands on the target
+   */
+  void setView(const sf::View& view);
+  const sf::FloatRect& getViewBounds() const { return viewBounds; }
+
+  /*!
+   * \brief getVisibleBounds is the view rectangle clipped to the world (empty when it misses)
+   */
+  const sf::FloatRect& getVisibleBounds() const { return visibleBounds; }
+
+  /*!
+   * \brief getCellIndex returns the cell holding position, or -1 when the box of
+   * the given radius around it lies entirely outside the world. Positions just
+   * past the border but still reaching into the world map to the border cell.
+   */
+  int getCellIndex(sf::Vector2f position, float radius = 0.0f) const;
+  int getCellCount() const { return columns * rows; }
+
+  /*!
+   * \brief getVisibleCells returns the inclusive cell range shown by the view,
+   * grown by margin pixels so items binned by their centre but reaching into the
+   * view are kept. Returns false when no cell is visible.
+   */
+  bool getVisibleCells(float margin, sf::Vector2i& first, sf::Vector2i& last) const;
+
+  // Broad-phase visibility queries - false for anything outside the world
+  bool isVisible(sf::Vector2f position, float radius) const;
+  bool isVisible(const sf::FloatRect& bounds) const;
+
+  int getColumns() const { return columns; }
+  int getRows() const { return rows; }
+  int getVisibleCellCount() const;
+
+private:
+  sf::FloatRect worldBounds;
+  int columns;
+  int rows;
+  sf::Vector2f inverseCellSize;
+
+  sf::FloatRect viewBounds;
+  sf::FloatRect visibleBounds; // viewBounds clipped to worldBounds
+  sf::Vector2i visibleMin;     // Inclusive cell range shown by the view
+  sf::Vector2i visibleMax;
+  bool viewValid;
+
+  // Cell of a coordinate already known to lie inside the world
+  int columnAt(float x) const;
+  int rowAt(float y) const;
+  bool cellRange(const sf::FloatRect& bounds, sf::Vector2i& first, sf::Vector2i& last) const;
+};
+
+/*!
+ * \brief CellBins sorts item indices by grid cell so a draw path can walk the
+ * visible cells only. Storage is reused between frames.
+ */
+class CellBins {
+public:
+  /*!
+   * \brief build bins items by their cell index from SpatialGrid::getCellIndex;
+   * items with index -1 are outside the world and dropped
+   */
+  void build(const std::vector<int>& itemCells, int cellCount);
+
+  const std::uint32_t* begin(int cell) const { return items.data() + cellStart[cell]; }
+  const std::uint32_t* end(int cell) const { return items.data() + cellStart[cell + 1]; }
+
+private:
+  std::vector<std::uint32_t> cellStart;
+  std::vector<std::uint32_t> items;
+  std::vector<std::uint32_t> scatter; // Write cursor per cell while building
+};
+
+} // namespace DP
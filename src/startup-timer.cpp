@@ -0,0 +1,55 @@
+#include "startup-timer.h"
+
+namespace DP {
+
+namespace {
+double millisecondsBetween(std::chrono::steady_clock::time_point from,
+                           std::chrono::steady_clock::time_point to) {
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+} // namespace
+
+StartupTimer& StartupTimer::getInstance() {
+  static StartupTimer instance;
+  return instance;
+}
+
+StartupTimer::StartupTimer()
+  : start(std::chrono::steady_clock::now())
+  , last(start) {}
+
+void StartupTimer::mark(const std::string& phase) {
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  phases.push_back({phase, millisecondsBetween(last, now), false});
+  last = now;
+}
+
+void StartupTimer::addNested(const std::string& phase, double ms) {
+  phases.push_back({phase, ms, true});
+}
+
+StartupTimer::Scope::Scope(const char* scopeName)
+  : name(scopeName)
+  , begin(std::chrono::steady_clock::now()) {}
+
+StartupTimer::Scope::~Scope() {
+  StartupTimer::getInstance().addNested(
+      name, millisecondsBetween(begin, std::chrono::steady_clock::now()));
+}
+
+double StartupTimer::getTotalMs() const {
+  return millisecondsBetween(start, last);
+}
+
+void StartupTimer::writeJson(std::ostream& out) const {
+  // Names are fixed identifiers, so no escaping is needed
+  out << "{\n  \"total_ms\": " << getTotalMs() << ",\n  \"phases\": [";
+  for (std::size_t i = 0; i < phases.size(); ++i) {
+    out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << phases[i].name
+        << "\", \"ms\": " << phases[i].ms
+        << ", \"nested\": " << (phases[i].nested ? "true" : "false") << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+} // namespace DP
@@ -0,0 +1,59 @@
+#pragma once
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace DP {
+
+/*!
+ * \brief StartupTimer records how long each startup phase takes
+ *
+ * Always on; a handful of clock reads per run. Phases recorded with mark()
+ * follow each other and add up to the total. Phases timed with a Scope may
+ * lie inside a marked phase, e.g. TextureHolder inside the Game members, and
+ * are reported separately as nested.
+ *
+ * `DeerPortal --startup-bench` prints the breakdown as JSON after the first
+ * menu frame.
+ */
+class StartupTimer {
+public:
+  static StartupTimer& getInstance();
+
+  // Ends the current phase under the given name and starts the next one
+  void mark(const std::string& phase);
+
+  // Records a nested phase measured elsewhere, e.g. one shader's compile time
+  void addNested(const std::string& phase, double ms);
+
+  class Scope {
+  public:
+    explicit Scope(const char* scopeName);
+    ~Scope();
+
+  private:
+    const char* name;
+    std::chrono::steady_clock::time_point begin;
+  };
+
+  // Milliseconds from the first use of the timer to the last mark
+  double getTotalMs() const;
+
+  void writeJson(std::ostream& out) const;
+
+private:
+  struct Phase {
+    std::string name;
+    double ms;
+    bool nested;
+  };
+
+  StartupTimer();
+
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point last;
+  std::vector<Phase> phases;
+};
+
+} // namespace DP
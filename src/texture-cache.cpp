@@ -0,0 +1,245 @@
+#include "texture-cache.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "asset-archive.h"
+#include "little-endian.h"
+#include "profiler.h"
+
+namespace fs = std::filesystem;
+
+namespace DP {
+
+namespace {
+// FNV-1a; a few milliseconds for all game art, far below the inflate it saves
+std::uint64_t hashBytes(const void* data, std::size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  std::uint64_t hash = 14695981039346656037ull;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+fs::path userCacheRoot() {
+#ifdef _WIN32
+  if (const char* local = std::getenv("LOCALAPPDATA")) {
+    return fs::path(local) / "deerportal" / "cache";
+  }
+#elif defined(__APPLE__)
+  if (const char* home = std::getenv("HOME")) {
+    return fs::path(home) / "Library" / "Caches" / "deerportal";
+  }
+#else
+  const char* xdg = std::getenv("XDG_CACHE_HOME");
+  if (xdg != nullptr && xdg[0] != '\0') {
+    return fs::path(xdg) / "deerportal";
+  }
+  if (const char* home = std::getenv("HOME")) {
+    return fs::path(home) / ".cache" / "deerportal";
+  }
+#endif
+  return fs::path();
+}
+
+// Creates the directory for this version and drops the ones of other versions
+bool prepareDirectory(const fs::path& directory) {
+  std::error_code error;
+  fs::create_directories(directory, error);
+  if (error) {
+    std::cerr << "TextureCache: cannot create " << directory.string() << ": " << error.message()
+              << std::endl;
+    return false;
+  }
+
+  const std::string current = directory.filename().string();
+  for (fs::directory_iterator it(directory.parent_path(), error), end; !error && it != end;
+       it.increment(error)) {
+    const std::string name = it->path().filename().string();
+    if (name != current && name.compare(0, 9, "textures-") == 0) {
+      std::error_code ignored;
+      fs::remove_all(it->path(), ignored);
+    }
+  }
+  return true;
+}
+} // namespace
+
+DecodedPixels::DecodedPixels() : pixels(nullptr) {}
+
+bool DecodedPixels::upload(sf::Texture& texture) const {
+  if (!isValid() || !texture.resize(size)) {
+    return false;
+  }
+  texture.update(pixels);
+  return true;
+}
+
+void DecodedPixels::copyTo(sf::Image& target) const {
+  if (isValid()) {
+    target.resize(size, pixels);
+  }
+}
+
+void DecodedPixels::clear() {
+  entry.close();
+  image = sf::Image();
+  size = sf::Vector2u();
+  pixels = nullptr;
+}
+
+TextureCache& TextureCache::getInstance() {
+  static TextureCache instance;
+  return instance;
+}
+
+TextureCache::TextureCache() : enabled(false), tempCounter(0) {
+  const char* setting = std::getenv("DP_TEXTURE_CACHE");
+  if (setting != nullptr && std::strcmp(setting, "0") == 0) {
+    return;
+  }
+  const fs::path root = userCacheRoot();
+  if (root.empty()) {
+    return;
+  }
+
+  const fs::path versioned = root / (std::string("textures-") + DEERPORTAL_VERSION);
+  if (!prepareDirectory(versioned)) {
+    return;
+  }
+  directory = versioned.string();
+  enabled.store(true, std::memory_order_relaxed);
+#ifndef NDEBUG
+  std::cout << "TextureCache: " << directory << std::endl;
+#endif
+}
+
+void TextureCache::setEnabled(bool newEnabled) {
+  enabled.store(newEnabled && !directory.empty(), std::memory_order_relaxed);
+}
+
+std::string TextureCache::entryPath(std::uint64_t sourceHash) const {
+  static const char digits[] = "0123456789abcdef";
+  std::string name(16, '0');
+  for (int i = 15; i >= 0; --i, sourceHash >>= 4) {
+    name[i] = digits[sourceHash & 0xf];
+  }
+  return (fs::path(directory) / (name + ".rgba")).string();
+}
+
+bool TextureCache::decode(const std::string& file, DecodedPixels& out) {
+  DP_PROFILE_ZONE("TextureCache::decode");
+  out.clear();
+
+  // Source bytes straight from the archive mapping, or read once from disk
+  const void* source = nullptr;
+  std::size_t sourceSize = 0;
+  std::vector<char> loose;
+  if (const AssetArchive::Entry* entry = AssetArchive::getInstance().find(file)) {
+    source = entry->data;
+    sourceSize = entry->size;
+  } else {
+    std::ifstream stream(getAssetPath(file), std::ios::binary | std::ios::ate);
+    if (!stream) {
+      return false;
+    }
+    loose.resize(static_cast<std::size_t>(stream.tellg()));
+    stream.seekg(0);
+    if (!stream.read(loose.data(), static_cast<std::streamsize>(loose.size()))) {
+      return false;
+    }
+    source = loose.data();
+    sourceSize = loose.size();
+  }
+
+  const bool useCache = isEnabled();
+  std::uint64_t sourceHash = 0;
+  std::string path;
+  if (useCache) {
+    sourceHash = hashBytes(source, sourceSize);
+    path = entryPath(sourceHash);
+    if (readEntry(path, sourceHash, sourceSize, out)) {
+      return true;
+    }
+  }
+
+  if (!out.image.loadFromMemory(source, sourceSize)) {
+    return false;
+  }
+  out.size = out.image.getSize();
+  out.pixels = out.image.getPixelsPtr();
+
+  if (useCache) {
+    writeEntry(path, sourceHash, sourceSize, out.image);
+  }
+  return true;
+}
+
+bool TextureCache::readEntry(const std::string& path, std::uint64_t sourceHash,
+                             std::uint64_t sourceSize, DecodedPixels& out) const {
+  MappedFile entry;
+  if (!entry.open(path) || entry.size() < HEADER_SIZE) {
+    return false;
+  }
+
+  const unsigned char* header = entry.data();
+  const std::uint32_t width = readU32(header + 8);
+  const std::uint32_t height = readU32(header + 12);
+  const std::uint64_t expectedSize =
+      HEADER_SIZE + static_cast<std::uint64_t>(width) * static_cast<std::uint64_t>(height) * 4;
+  if (std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0 || readU32(header + 4) != VERSION ||
+      width == 0 || height == 0 || readU64(header + 16) != sourceHash ||
+      readU64(header + 24) != sourceSize || entry.size() != expectedSize) {
+#ifndef NDEBUG
+    std::cout << "TextureCache: stale entry " << path << std::endl;
+#endif
+    return false;
+  }
+
+  out.size = sf::Vector2u(width, height);
+  out.pixels = entry.data() + HEADER_SIZE;
+  out.entry = std::move(entry);
+  return true;
+}
+
+void TextureCache::writeEntry(const std::string& path, std::uint64_t sourceHash,
+                              std::uint64_t sourceSize, const sf::Image& image) {
+  // Written under a unique name and renamed, so readers never see half an entry
+  const std::string temp =
+      path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+      "-" + std::to_string(tempCounter.fetch_add(1));
+  const sf::Vector2u size = image.getSize();
+  {
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out.write(MAGIC, sizeof(MAGIC));
+    writeU32(out, VERSION);
+    writeU32(out, size.x);
+    writeU32(out, size.y);
+    writeU64(out, sourceHash);
+    writeU64(out, sourceSize);
+    out.write(reinterpret_cast<const char*>(image.getPixelsPtr()),
+              static_cast<std::streamsize>(size.x) * size.y * 4);
+    if (!out.flush()) {
+      out.close();
+      std::error_code ignored;
+      fs::remove(temp, ignored);
+      return;
+    }
+  }
+
+  std::error_code error;
+  fs::rename(temp, path, error);
+  if (error) {
+    std::error_code ignored;
+    fs::remove(temp, ignored);
+  }
+}
+
+} // namespace DP
@@ -0,0 +1,97 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <SFML/Graphics.hpp>
+
+#include "mapped-file.h"
+
+namespace DP {
+
+/*!
+ * \brief DecodedPixels holds the RGBA pixels of one texture
+ *
+ * They point either into a mapped cache entry or into a freshly decoded
+ * image; callers do not need to know which.
+ */
+class DecodedPixels {
+public:
+  DecodedPixels();
+
+  bool isValid() const { return pixels != nullptr; }
+  bool isCached() const { return entry.isOpen(); }
+  sf::Vector2u getSize() const { return size; }
+  const std::uint8_t* getPixels() const { return pixels; }
+
+  // GL upload, so only on the thread that owns the context
+  bool upload(sf::Texture& texture) const;
+  void copyTo(sf::Image& image) const;
+
+  void clear();
+
+private:
+  friend class TextureCache;
+
+  MappedFile entry;
+  sf::Image image;
+  sf::Vector2u size;
+  const std::uint8_t* pixels;
+};
+
+/*!
+ * \brief TextureCache keeps decoded textures so later launches skip PNG decoding
+ *
+ * Entries are raw RGBA in the user cache directory, one file per source image,
+ * named after a hash of the source bytes. A lookup hashes the source, maps the
+ * entry and checks its header against the source hash, size and dimensions;
+ * anything that does not match is treated as a miss, decoded normally and
+ * written again. Entries live in a directory per game version and those of
+ * other versions are removed on start, so the cache does not grow across
+ * upgrades.
+ *
+ * Safe to call from several decoder threads at once. Disabled with
+ * --no-texture-cache or DP_TEXTURE_CACHE=0, and when no cache directory exists.
+ *
+ * Entry layout, all integers little-endian:
+ *   "DPTX", u32 version, u32 width, u32 height, u64 source hash, u64 source size
+ *   width * height * 4 bytes of RGBA pixels
+ */
+class TextureCache {
+public:
+  static constexpr char MAGIC[4] = {'D', 'P', 'T', 'X'};
+  static constexpr std::uint32_t VERSION = 1;
+  static constexpr std::size_t HEADER_SIZE = 32;
+
+  static TextureCache& getInstance();
+
+  TextureCache(const TextureCache&) = delete;
+  TextureCache& operator=(const TextureCache&) = delete;
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+  const std::string& getDirectory() const { return directory; }
+
+  /*!
+   * \brief decode returns the pixels of an image asset
+   * \param file Path inside the assets directory, e.g. "img/deer-god.png"
+   * \return false if the source is missing or cannot be decoded
+   */
+  bool decode(const std::string& file, DecodedPixels& out);
+
+private:
+  TextureCache();
+
+  std::atomic<bool> enabled;
+  std::string directory;
+  std::atomic<unsigned int> tempCounter;
+
+  std::string entryPath(std::uint64_t sourceHash) const;
+  bool readEntry(const std::string& path, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                 DecodedPixels& out) const;
+  void writeEntry(const std::string& path, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                  const sf::Image& image);
+};
+
+} // namespace DP
@@ -2,7 +2,9 @@
 
 #include <iostream>
 
+#include "asset-loader.h"
 #include "exceptions.h"
+#include "startup-timer.h"
 
 namespace DP {
 
@@ -16,6 +18,7 @@ std::set<int> getTerrainSet() {
 
 } // namespace DP
 TextureHolder::TextureHolder() {
+  DP::StartupTimer::Scope timing("texture_holder");
   //     "stop", "card", "diamond", "diamond x 2"
 
   std::string cardsImages[4][4] = {{"card-water-stop.small.png", "card-water-remove-card.small.png",
@@ -29,40 +32,25 @@ TextureHolder::TextureHolder() {
 
   };
 
+  // Decoded in parallel, uploaded here; the whole set is needed before the
+  // game constructs anything that reads texture sizes. Menu and full-screen
+  // art is streamed per state instead, see Game::loadAssets
+  DP::AssetLoader loader;
   for (int i = 0; i < 4; i++) {
     for (int j = 0; j < 4; j++) {
-      if (!cardsTextures[i][j].loadFromFile(
-              get_full_path(ASSETS_PATH "img/cards/" + cardsImages[i][j]))) {
-        //                std::cout << "assets/img/cards/" << cardsImages[i][j];
-        throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                             "img/cards/" + cardsImages[i][j],
-                                             "Failed to load card texture");
-      } else {
-        //                std::cout << "assets/img/cards/" << cardsImages[i][j] << " ok " << i << "
-        //                " <<  j << " " << std::endl;
-      }
+      loader.addTexture(cardsTextures[i][j], "img/cards/" + cardsImages[i][j],
+                        "Failed to load card texture");
     }
   }
 
-  if (!textureCardBases[0].loadFromFile(get_full_path(ASSETS_PATH "img/card-water-2-diam_m.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/card-water-2-diam_m.png",
-                                         "Failed to load water card base texture");
-
-  if (!textureCardBases[1].loadFromFile(get_full_path(ASSETS_PATH "img/card-earth-2-diam_m.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/card-earth-2-diam_m.png",
-                                         "Failed to load earth card base texture");
-
-  if (!textureCardBases[2].loadFromFile(get_full_path(ASSETS_PATH "img/card-fire-2-diam_m.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/card-fire-2-diam_m.png",
-                                         "Failed to load fire card base texture");
-
-  if (!textureCardBases[3].loadFromFile(get_full_path(ASSETS_PATH "img/card-air-2-diam_m.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/card-air-2-diam_m.png",
-                                         "Failed to load air card base texture");
+  loader.addTexture(textureCardBases[0], "img/card-water-2-diam_m.png",
+                    "Failed to load water card base texture");
+  loader.addTexture(textureCardBases[1], "img/card-earth-2-diam_m.png",
+                    "Failed to load earth card base texture");
+  loader.addTexture(textureCardBases[2], "img/card-fire-2-diam_m.png",
+                    "Failed to load fire card base texture");
+  loader.addTexture(textureCardBases[3], "img/card-air-2-diam_m.png",
+                    "Failed to load air card base texture");
 
   //    if (!textureGameBackground.loadFromFile(ASSETS_PATH"assets/img/game-ackground.png"))
   //        std::exit(1);
@@ -79,46 +67,16 @@ TextureHolder::TextureHolder() {
   //    if (!textureSeasons.loadFromFile(ASSETS_PATH"assets/img/seasons.png"))
   //        std::exit(1);
 
-  if (!textureCharacters.loadFromFile(get_full_path(ASSETS_PATH "img/characters-new.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/characters-new.png",
-                                         "Failed to load characters texture");
-
-  if (!backgroundDark.loadFromFile(get_full_path(ASSETS_PATH "img/background_dark.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/background_dark.png",
-                                         "Failed to load dark background texture");
-  if (!textureBoardDiamond.loadFromFile(get_full_path(ASSETS_PATH "img/board_diamonds.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/board_diamonds.png",
-                                         "Failed to load board diamonds texture");
-
-  if (!textureMenu.loadFromFile(get_full_path(ASSETS_PATH "img/dp_intro_menu.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/dp_intro_menu.png",
-                                         "Failed to load intro menu texture");
-
-  if (!textureLetsBegin.loadFromFile(get_full_path(ASSETS_PATH "img/letsbegin.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/letsbegin.png", "Failed to load lets begin texture");
-
-  if (!textureButtonCpu.loadFromFile(get_full_path(ASSETS_PATH "img/button-cpu.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/button-cpu.png", "Failed to load CPU button texture");
-
-  if (!textureButtonHuman.loadFromFile(get_full_path(ASSETS_PATH "img/button-human.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/button-human.png",
-                                         "Failed to load human button texture");
-
-  if (!textureDeerGod.loadFromFile(get_full_path(ASSETS_PATH "img/deer-god.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/deer-god.png", "Failed to load deer god texture");
-
-  if (!textureBigDiamond.loadFromFile(get_full_path(ASSETS_PATH "img/diamond-big.png")))
-    throw DeerPortal::AssetLoadException(DeerPortal::AssetLoadException::TEXTURE,
-                                         "img/diamond-big.png",
-                                         "Failed to load big diamond texture");
+  loader.addTexture(textureCharacters, "img/characters-new.png",
+                    "Failed to load characters texture");
+  loader.addTexture(backgroundDark, "img/background_dark.png",
+                    "Failed to load dark background texture");
+  loader.addTexture(textureBoardDiamond, "img/board_diamonds.png",
+                    "Failed to load board diamonds texture");
+  loader.addTexture(textureButtonCpu, "img/button-cpu.png", "Failed to load CPU button texture");
+  loader.addTexture(textureButtonHuman, "img/button-human.png",
+                    "Failed to load human button texture");
+  loader.load();
 
   int defaultArray[5][8] = {
       // Cash   Food    Energy  Faith
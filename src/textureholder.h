@@ -27,14 +27,14 @@ public:
   //    sf::Texture textureTiles;
   //    sf::Texture textureFaces;
   //    sf::Texture textureGui;
-  sf::Texture textureMenu;
+  sf::Texture textureMenu; // Streamed per state by Game, empty while released
   //    sf::Texture textureSymbols;
   //    sf::Texture textureSeasons;
   sf::Texture backgroundDark;
   sf::Texture textureCharacters;
   //    sf::Texture textureGameBackground;
   sf::Texture textureBoardDiamond;
-  sf::Texture textureLetsBegin;
+  sf::Texture textureLetsBegin; // Streamed
 
   sf::Texture textureCardBase0;
   sf::Texture textureCardBase1;
@@ -44,7 +44,7 @@ public:
   sf::Texture textureButtonCpu;
   sf::Texture textureButtonHuman;
 
-  sf::Texture textureDeerGod;
+  sf::Texture textureDeerGod; // Streamed
 
   std::array<sf::Texture, 4> textureCardBases;
 
@@ -53,7 +53,7 @@ public:
 
   std::array<std::array<sf::Texture, 4>, 4> cardsTextures;
 
-  sf::Texture textureBigDiamond;
+  sf::Texture textureBigDiamond; // Streamed
 };
 
 #endif // TEXTUREHOLDER_H
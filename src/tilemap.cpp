@@ -1,4 +1,6 @@
 #include "tilemap.h"
+
+#include "draw-stats.h"
 namespace DP {
 
 /*!
@@ -149,6 +151,7 @@ void TileMap::draw(sf::RenderTarget& target, sf::RenderStates states) const {
 
   // draw the vertex array
   target.draw(m_vertices, states);
+  DP::DrawStats::count();
 }
 
 sf::VertexArray m_vertices;
@@ -0,0 +1,271 @@
+#include "tween-engine.h"
+#include <algorithm>
+#include "easing.h"
+
+namespace DP {
+
+namespace {
+constexpr uint32_t SLOT_BITS = 20;
+constexpr uint32_t SLOT_MASK = (1u << SLOT_BITS) - 1;
+constexpr uint16_t GENERATION_MASK = 0xFFF;
+constexpr size_t INITIAL_CAPACITY = 256;
+} // namespace
+
+float applyEase(Ease ease, float t) {
+  switch (ease) {
+  case Ease::InQuad:
+    return Easing::easeInQuad(t);
+  case Ease::OutQuad:
+    return Easing::easeOutQuad(t);
+  case Ease::InOutQuad:
+    return Easing::easeInOutQuad(t);
+  case Ease::InCubic:
+    return Easing::easeInCubic(t);
+  case Ease::OutCubic:
+    return Easing::easeOutCubic(t);
+  case Ease::InOutCubic:
+    return Easing::easeInOutCubic(t);
+  case Ease::Linear:
+  default:
+    return t;
+  }
+}
+
+TweenEngine::TweenEngine()
+  : slotCount(0)
+  , liveCount(0) {
+  elapsed.reserve(INITIAL_CAPACITY);
+  duration.reserve(INITIAL_CAPACITY);
+  progress.reserve(INITIAL_CAPACITY);
+  generation.reserve(INITIAL_CAPACITY);
+  state.reserve(INITIAL_CAPACITY);
+  successor.reserve(INITIAL_CAPACITY);
+  freeSlots.reserve(INITIAL_CAPACITY);
+  moves.reserve(INITIAL_CAPACITY);
+  scales.reserve(INITIAL_CAPACITY);
+  fades.reserve(INITIAL_CAPACITY);
+  completed.reserve(INITIAL_CAPACITY);
+}
+
+TweenHandle TweenEngine::allocate(float seconds, SlotState initialState) {
+  uint32_t slot;
+  if (!freeSlots.empty()) {
+    slot = freeSlots.back();
+    freeSlots.pop_back();
+  } else {
+    if (slotCount > SLOT_MASK) {
+      return INVALID_TWEEN;
+    }
+    slot = slotCount++;
+    elapsed.push_back(0.0f);
+    duration.push_back(0.0f);
+    progress.push_back(0.0f);
+    generation.push_back(1);
+    state.push_back(SLOT_FREE);
+    successor.push_back(INVALID_TWEEN);
+  }
+
+  elapsed[slot] = 0.0f;
+  duration[slot] = seconds;
+  progress[slot] = 0.0f;
+  state[slot] = initialState;
+  successor[slot] = INVALID_TWEEN;
+  ++liveCount;
+
+  return (static_cast<uint32_t>(generation[slot]) << SLOT_BITS) | slot;
+}
+
+void TweenEngine::release(uint32_t slot) {
+  state[slot] = SLOT_FREE;
+  successor[slot] = INVALID_TWEEN;
+  generation[slot] = (generation[slot] + 1) & GENERATION_MASK;
+  if (generation[slot] == 0) {
+    generation[slot] = 1; // Keep handles non-zero
+  }
+  freeSlots.push_back(slot);
+}
+
+bool TweenEngine::resolve(TweenHandle tween, uint32_t& slot) const {
+  if (tween == INVALID_TWEEN) return false;
+  slot = tween & SLOT_MASK;
+  return slot < slotCount && generation[slot] == (tween >> SLOT_BITS) && state[slot] != SLOT_FREE;
+}
+
+bool TweenEngine::isAlive(TweenHandle tween) const {
+  uint32_t slot;
+  return resolve(tween, slot) && (state[slot] == SLOT_RUNNING || state[slot] == SLOT_WAITING);
+}
+
+TweenHandle TweenEngine::create(float seconds) {
+  return allocate(seconds, SLOT_RUNNING);
+}
+
+TweenHandle TweenEngine::chain(TweenHandle predecessor, float seconds) {
+  if (!isAlive(predecessor)) {
+    return create(seconds);
+  }
+
+  // Append to the end of the predecessor's chain
+  uint32_t slot = predecessor & SLOT_MASK;
+  uint32_t next;
+  while (resolve(successor[slot], next)) {
+    slot = next;
+  }
+
+  TweenHandle tween = allocate(seconds, SLOT_WAITING);
+  successor[slot] = tween;
+  return tween;
+}
+
+void TweenEngine::addMove(TweenHandle tween, sf::Transformable* target, sf::Vector2f from,
+                          sf::Vector2f to, Ease ease) {
+  uint32_t slot;
+  if (!target || !resolve(tween, slot)) return;
+  moves.push_back({slot, target, from, to - from, ease});
+}
+
+void TweenEngine::addScale(TweenHandle tween, sf::Transformable* target, sf::Vector2f from,
+                           sf::Vector2f to, Ease ease) {
+  uint32_t slot;
+  if (!target || !resolve(tween, slot)) return;
+  scales.push_back({slot, target, from, to - from, ease});
+}
+
+void TweenEngine::addFadeChannel(TweenHandle tween, sf::Transformable* target, float from,
+                                 float to, Ease ease, FadeKind kind) {
+  uint32_t slot;
+  if (!target || !resolve(tween, slot)) return;
+  fades.push_back({slot, target, from, to - from, ease, kind});
+}
+
+void TweenEngine::addFade(TweenHandle tween, sf::Sprite* target, float from, float to, Ease ease) {
+  addFadeChannel(tween, target, from, to, ease, FADE_SPRITE);
+}
+
+void TweenEngine::addFade(TweenHandle tween, sf::Shape* target, float from, float to, Ease ease) {
+  addFadeChannel(tween, target, from, to, ease, FADE_SHAPE);
+}
+
+void TweenEngine::addFade(TweenHandle tween, sf::Text* target, float from, float to, Ease ease) {
+  addFadeChannel(tween, target, from, to, ease, FADE_TEXT);
+}
+
+template <typename Channel> void TweenEngine::compact(std::vector<Channel>& channels) {
+  // Stable removal keeps channels on the same target applied in creation order
+  channels.erase(std::remove_if(channels.begin(), channels.end(),
+                                [this](const Channel& channel) {
+                                  return state[channel.slot] == SLOT_DONE;
+                                }),
+                 channels.end());
+}
+
+void TweenEngine::update(float deltaSeconds) {
+  completed.clear();
+  if (freeSlots.size() == slotCount) {
+    return; // Nothing allocated
+  }
+
+  // Advance timings
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (state[slot] != SLOT_RUNNING) continue;
+    elapsed[slot] += deltaSeconds;
+    progress[slot] =
+        duration[slot] > 0.0f ? std::min(1.0f, elapsed[slot] / duration[slot]) : 1.0f;
+  }
+
+  // Apply channels
+  for (const VectorChannel& move : moves) {
+    if (state[move.slot] != SLOT_RUNNING) continue;
+    move.target->setPosition(move.from + move.delta * applyEase(move.ease, progress[move.slot]));
+  }
+  for (const VectorChannel& scale : scales) {
+    if (state[scale.slot] != SLOT_RUNNING) continue;
+    scale.target->setScale(scale.from +
+                           scale.delta * applyEase(scale.ease, progress[scale.slot]));
+  }
+  for (const FadeChannel& fade : fades) {
+    if (state[fade.slot] != SLOT_RUNNING) continue;
+    const float alpha = fade.from + fade.delta * applyEase(fade.ease, progress[fade.slot]);
+    const uint8_t a = static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, alpha)));
+    switch (fade.kind) {
+    case FADE_SPRITE: {
+      auto* sprite = static_cast<sf::Sprite*>(fade.target);
+      sf::Color color = sprite->getColor();
+      color.a = a;
+      sprite->setColor(color);
+      break;
+    }
+    case FADE_SHAPE: {
+      auto* shape = static_cast<sf::Shape*>(fade.target);
+      sf::Color color = shape->getFillColor();
+      color.a = a;
+      shape->setFillColor(color);
+      break;
+    }
+    case FADE_TEXT: {
+      auto* text = static_cast<sf::Text*>(fade.target);
+      sf::Color color = text->getFillColor();
+      color.a = a;
+      text->setFillColor(color);
+      break;
+    }
+    }
+  }
+
+  // Retire finished tweens and start their successors
+  bool anyDone = false;
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (state[slot] == SLOT_DONE) {
+      anyDone = true; // Cancelled since the last update
+      continue;
+    }
+    if (state[slot] != SLOT_RUNNING || progress[slot] < 1.0f) continue;
+
+    state[slot] = SLOT_DONE;
+    --liveCount;
+    anyDone = true;
+    completed.push_back((static_cast<uint32_t>(generation[slot]) << SLOT_BITS) | slot);
+
+    uint32_t next;
+    if (resolve(successor[slot], next) && state[next] == SLOT_WAITING) {
+      state[next] = SLOT_RUNNING;
+      elapsed[next] = 0.0f;
+      progress[next] = 0.0f;
+    }
+  }
+
+  if (!anyDone) return;
+
+  compact(moves);
+  compact(scales);
+  compact(fades);
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (state[slot] == SLOT_DONE) {
+      release(slot);
+    }
+  }
+}
+
+void TweenEngine::cancel(TweenHandle tween) {
+  uint32_t slot;
+  while (resolve(tween, slot) && (state[slot] == SLOT_RUNNING || state[slot] == SLOT_WAITING)) {
+    state[slot] = SLOT_DONE;
+    --liveCount;
+    tween = successor[slot];
+  }
+}
+
+void TweenEngine::clear() {
+  for (uint32_t slot = 0; slot < slotCount; ++slot) {
+    if (state[slot] != SLOT_FREE) {
+      release(slot);
+    }
+  }
+  moves.clear();
+  scales.clear();
+  fades.clear();
+  completed.clear();
+  liveCount = 0;
+}
+
+} // namespace DP
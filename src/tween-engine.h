@@ -0,0 +1,132 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace DP {
+
+/*!
+ * \brief Easing curves available to tweens, dispatched by a switch
+ */
+enum class Ease : uint8_t {
+  Linear,
+  InQuad,
+  OutQuad,
+  InOutQuad,
+  InCubic,
+  OutCubic,
+  InOutCubic
+};
+
+float applyEase(Ease ease, float t);
+
+/*!
+ * \brief Integer handle to a tween: slot index in the low 20 bits, slot
+ * generation in the high 12 bits, so stale handles never alias a reused slot.
+ * Zero is never a valid handle.
+ */
+using TweenHandle = uint32_t;
+constexpr TweenHandle INVALID_TWEEN = 0;
+
+/*!
+ * \brief TweenEngine animates sprite, shape and text properties from flat pools
+ *
+ * A tween is a timing slot (elapsed, duration, state) stored as parallel
+ * arrays. Move, scale and fade channels live in their own contiguous POD
+ * pools and reference their slot by index, so an update is one pass over
+ * the timings followed by one tight pass per channel, with no virtual calls,
+ * no std::function and no allocation once the pools have grown.
+ *
+ * Tweens are chained by handle: a tween created with chain() waits until its
+ * predecessor completes and then starts. Finished handles are reported by
+ * getCompleted() until the next update, which lets owners release resources
+ * tied to a tween without callbacks.
+ */
+class TweenEngine {
+public:
+  TweenEngine();
+
+  /*!
+   * \brief create starts a new tween running for duration seconds
+   */
+  TweenHandle create(float duration);
+
+  /*!
+   * \brief chain creates a tween that starts when predecessor completes
+   * If the predecessor is no longer alive the tween starts immediately.
+   */
+  TweenHandle chain(TweenHandle predecessor, float duration);
+
+  // Channels (a tween may drive any combination of them)
+  void addMove(TweenHandle tween, sf::Transformable* target, sf::Vector2f from, sf::Vector2f to,
+               Ease ease = Ease::Linear);
+  void addScale(TweenHandle tween, sf::Transformable* target, sf::Vector2f from, sf::Vector2f to,
+                Ease ease = Ease::Linear);
+  void addFade(TweenHandle tween, sf::Sprite* target, float from, float to,
+               Ease ease = Ease::Linear);
+  void addFade(TweenHandle tween, sf::Shape* target, float from, float to,
+               Ease ease = Ease::Linear);
+  void addFade(TweenHandle tween, sf::Text* target, float from, float to,
+               Ease ease = Ease::Linear);
+
+  void update(float deltaSeconds);
+
+  /*!
+   * \brief cancel stops a tween and everything chained after it
+   * Cancelled tweens are not reported as completed.
+   */
+  void cancel(TweenHandle tween);
+  void clear();
+
+  bool isAlive(TweenHandle tween) const;
+  size_t getActiveCount() const { return liveCount; }
+  const std::vector<TweenHandle>& getCompleted() const { return completed; }
+
+private:
+  enum SlotState : uint8_t { SLOT_FREE, SLOT_WAITING, SLOT_RUNNING, SLOT_DONE };
+  enum FadeKind : uint8_t { FADE_SPRITE, FADE_SHAPE, FADE_TEXT };
+
+  struct VectorChannel {
+    uint32_t slot;
+    sf::Transformable* target;
+    sf::Vector2f from;
+    sf::Vector2f delta;
+    Ease ease;
+  };
+
+  struct FadeChannel {
+    uint32_t slot;
+    sf::Transformable* target;
+    float from;
+    float delta;
+    Ease ease;
+    FadeKind kind;
+  };
+
+  // Timing slots, one entry per slot index
+  std::vector<float> elapsed;
+  std::vector<float> duration;
+  std::vector<float> progress;
+  std::vector<uint16_t> generation;
+  std::vector<uint8_t> state;
+  std::vector<TweenHandle> successor;
+  std::vector<uint32_t> freeSlots;
+  uint32_t slotCount;
+  size_t liveCount;
+
+  // Channel pools
+  std::vector<VectorChannel> moves;
+  std::vector<VectorChannel> scales;
+  std::vector<FadeChannel> fades;
+
+  std::vector<TweenHandle> completed;
+
+  TweenHandle allocate(float duration, SlotState initialState);
+  void release(uint32_t slot);
+  bool resolve(TweenHandle tween, uint32_t& slot) const;
+  void addFadeChannel(TweenHandle tween, sf::Transformable* target, float from, float to,
+                      Ease ease, FadeKind kind);
+  template <typename Channel> void compact(std::vector<Channel>& channels);
+};
+
+} // namespace DP
@@ -26,6 +26,7 @@ void WindowManager::initialize(sf::RenderWindow& window, const std::string& wind
   // Store current window position if window is already created
   if (window.isOpen()) {
     m_windowedPosition = window.getPosition();
+    m_framePacer.applyToWindow(window);
   }
 
 #ifndef NDEBUG
@@ -180,6 +181,14 @@ void WindowManager::restoreWindowPosition(sf::RenderWindow& window) {
   }
 }
 
+void WindowManager::setFramePacing(sf::RenderWindow& window, FramePacer::Mode mode,
+                                   float targetFps) {
+  m_framePacer.setMode(mode, targetFps);
+  if (window.isOpen()) {
+    m_framePacer.applyToWindow(window);
+  }
+}
+
 void WindowManager::createWindow(sf::RenderWindow& window, const sf::VideoMode& videoMode,
                                  std::uint32_t style, sf::State state) {
   // Create the window using SFML 3.0.1 API
@@ -189,9 +198,8 @@ void WindowManager::createWindow(sf::RenderWindow& window, const sf::VideoMode&
     throw std::runtime_error("Failed to create window");
   }
 
-  // Set window properties - disable V-Sync for maximum performance
-  window.setVerticalSyncEnabled(false); // Disable V-Sync for unlimited FPS
-  // Remove framerate limit to allow maximum performance
+  // V-Sync is per window, so a recreated window needs the pacing mode again
+  m_framePacer.applyToWindow(window);
 
 #ifndef NDEBUG
   std::cout << "Window created: " << videoMode.size.x << "x" << videoMode.size.y
@@ -281,7 +289,10 @@ void WindowManager::updateRenderTextureSize(sf::RenderTexture& renderTexture,
 #endif
 }
 
-void WindowManager::updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& window) {
+void WindowManager::updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& window,
+                                        float resolutionScale) {
+  // A scene rendered below native resolution is stretched back up
+  const float upscale = 1.0f / resolutionScale;
   if (m_isFullscreen) {
     // Calculate simple scaling for fullscreen (avoid complex view calculations)
     sf::Vector2u windowSize = window.getSize();
@@ -290,7 +301,7 @@ void WindowManager::updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& wi
 
     // Use uniform scaling (maintain aspect ratio)
     float scale = std::min(scaleX, scaleY);
-    sprite.setScale(sf::Vector2f(scale, scale));
+    sprite.setScale(sf::Vector2f(scale * upscale, scale * upscale));
 
     // Center the sprite
     float offsetX = (windowSize.x - initScreenX * scale) / 2.0f;
@@ -298,7 +309,7 @@ void WindowManager::updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& wi
     sprite.setPosition(sf::Vector2f(offsetX, offsetY));
   } else {
     // Windowed mode: 1:1 scaling
-    sprite.setScale(sf::Vector2f(1.0f, 1.0f));
+    sprite.setScale(sf::Vector2f(upscale, upscale));
     sprite.setPosition(sf::Vector2f(0.0f, 0.0f));
   }
 }
@@ -7,6 +7,8 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 
+#include "frame-pacer.h"
+
 namespace DP {
 
 /*!
@@ -93,11 +95,24 @@ public:
    * \brief Calculate sprite scaling and position for proper fullscreen rendering
    * \param sprite Reference to the render sprite
    * \param window Reference to the game's render window
+   * \param resolutionScale Render texture size as a fraction of the native resolution
    */
-  void updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& window);
+  void updateSpriteScaling(sf::Sprite& sprite, sf::RenderWindow& window,
+                           float resolutionScale = 1.0f);
 
   sf::View getView() const;
 
+  /*!
+   * \brief Change frame pacing and reapply vsync to the window
+   * \param window Reference to the game's render window
+   * \param mode Pacing mode
+   * \param targetFps Frame rate cap for the fixed and adaptive modes
+   */
+  void setFramePacing(sf::RenderWindow& window, FramePacer::Mode mode, float targetFps);
+
+  FramePacer& getFramePacer() { return m_framePacer; }
+  const FramePacer& getFramePacer() const { return m_framePacer; }
+
 private:
   bool m_isFullscreen;
   sf::VideoMode m_windowedMode;
@@ -105,6 +120,7 @@ private:
   sf::Vector2i m_windowedPosition;
   std::string m_windowTitle;
   sf::View m_view; // View for proper fullscreen scaling
+  FramePacer m_framePacer;
 
   /*!
    * \brief Initialize video modes for windowed and fullscreen